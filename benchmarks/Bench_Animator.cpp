@@ -0,0 +1,74 @@
+////////////////////////////////////////////////////////////////////////////////
+// IME - Infinite Motion Engine
+//
+// Copyright (c) 2020-2022 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Benchmark.h"
+#include "IME/core/animation/Animator.h"
+#include "IME/core/resources/ResourceLoader.h"
+#include "IME/graphics/Sprite.h"
+#include "IME/graphics/SpriteSheet.h"
+#include "IME/graphics/Texture.h"
+#include <cstdio>
+#include <iostream>
+
+namespace bench {
+    namespace {
+        const std::string spriteSheetFile = "ime_benchmark_spritesheet.png";
+        const ime::Vector2u frameSize{16, 16};
+        const unsigned int frameCount = 8;
+    }
+
+    void runAnimatorBenchmarks(Runner& runner) {
+        // Generate the spritesheet instead of shipping an image with the benchmarks
+        ime::Texture texture;
+        const std::string filename = ime::ResourceLoader::getPath(ime::ResourceType::Texture) + spriteSheetFile;
+        if (!texture.create(frameSize.x * frameCount, frameSize.y) || !texture.saveToFile(filename)) {
+            std::cerr << "Skipping Animator benchmarks: cannot create \"" << filename << "\"\n";
+            return;
+        }
+
+        const ime::SpriteSheet spriteSheet(spriteSheetFile, frameSize);
+
+        for (int spriteCount : {100, 1000}) {
+            std::vector<std::unique_ptr<ime::Sprite>> sprites;
+            for (int i = 0; i < spriteCount; ++i) {
+                auto animation = ime::Animation::create("walk", spriteSheet, ime::milliseconds(500));
+                animation->addFrames(ime::Index{0, 0}, frameCount);
+                animation->setLoop(true);
+
+                auto sprite = std::make_unique<ime::Sprite>();
+                sprite->getAnimator().addAnimation(animation);
+                sprite->getAnimator().startAnimation("walk");
+                sprites.push_back(std::move(sprite));
+            }
+
+            runner.run("Animator::update/" + std::to_string(spriteCount), [&] {
+                for (auto& sprite : sprites)
+                    sprite->getAnimator().update(ime::milliseconds(16));
+            });
+        }
+
+        // The texture remains cached by the engine, only the file is removed
+        std::remove(filename.c_str());
+    }
+}
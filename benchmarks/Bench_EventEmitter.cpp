@@ -0,0 +1,78 @@
+////////////////////////////////////////////////////////////////////////////////
+// IME - Infinite Motion Engine
+//
+// Copyright (c) 2020-2022 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Benchmark.h"
+#include "IME/core/event/EventEmitter.h"
+
+namespace bench {
+    void runEventEmitterBenchmarks(Runner& runner) {
+        for (int listenerCount : {1, 10, 100}) {
+            ime::EventEmitter emitter;
+            int sum = 0;
+            for (int i = 0; i < listenerCount; ++i)
+                emitter.on("event", ime::Callback<int>([&sum](int value) { sum += value; }));
+
+            runner.run("EventEmitter::emit/" + std::to_string(listenerCount), [&] {
+                emitter.emit("event", 1);
+            });
+
+            doNotOptimize(sum);
+        }
+
+        // The cost of emitting without synchronization
+        for (int listenerCount : {1, 10, 100}) {
+            ime::EventEmitter emitter(ime::EventEmitter::ThreadingPolicy::SingleThreaded);
+            int sum = 0;
+            for (int i = 0; i < listenerCount; ++i)
+                emitter.on("event", ime::Callback<int>([&sum](int value) { sum += value; }));
+
+            runner.run("EventEmitter::emit/single-threaded/" + std::to_string(listenerCount), [&] {
+                emitter.emit("event", 1);
+            });
+
+            doNotOptimize(sum);
+        }
+
+        // The cost of subscribing and notifying 'once' listeners, which are removed during the emission
+        {
+            ime::EventEmitter emitter(ime::EventEmitter::ThreadingPolicy::SingleThreaded);
+            int sum = 0;
+            runner.run("EventEmitter::emit/once/100", [&] {
+                for (int i = 0; i < 100; ++i)
+                    emitter.addOnceEventListener("event", ime::Callback<int>([&sum](int value) { sum += value; }));
+
+                emitter.emit("event", 1);
+            });
+
+            doNotOptimize(sum);
+        }
+
+        // The cost of emitting an event that no listener is subscribed to
+        ime::EventEmitter emitter;
+        emitter.on("event", ime::Callback<>([] {}));
+        runner.run("EventEmitter::emit/unsubscribed", [&] {
+            emitter.emit("otherEvent");
+        });
+    }
+}
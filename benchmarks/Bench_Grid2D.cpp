@@ -0,0 +1,70 @@
+////////////////////////////////////////////////////////////////////////////////
+// IME - Infinite Motion Engine
+//
+// Copyright (c) 2020-2022 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Benchmark.h"
+#include "IME/core/grid/Grid2D.h"
+#include "IME/core/physics/grid/path/BFS.h"
+#include "IME/core/physics/grid/path/DFS.h"
+#include "IME/core/scene/Scene.h"
+
+namespace bench {
+    namespace {
+        const ime::Vector2u gridSize{100, 100};
+    }
+
+    void runGrid2DBenchmarks(Runner& runner) {
+        ime::Scene scene;
+        ime::Grid2D grid(16, 16, scene);
+        grid.construct(gridSize, '.');
+
+        // Walk a diagonal across the grid so that lookups touch different rows
+        const ime::Vector2u gridSizeInPixels = grid.getSize();
+        float position = 0.0f;
+        runner.run("Grid2D::getTile(Vector2f)/100x100", [&] {
+            doNotOptimize(grid.getTile(ime::Vector2f{position, position}));
+            position += 17.0f;
+            if (position >= static_cast<float>(std::min(gridSizeInPixels.x, gridSizeInPixels.y)))
+                position = 0.0f;
+        });
+    }
+
+    void runPathFinderBenchmarks(Runner& runner) {
+        ime::Scene scene;
+        ime::Grid2D grid(16, 16, scene);
+        grid.construct(gridSize, '.');
+
+        const ime::Index source{0, 0};
+        const ime::Index target{static_cast<int>(gridSize.y) - 1, static_cast<int>(gridSize.x) - 1};
+
+        ime::BFS bfs(grid.getSizeInTiles());
+        runner.run("BFS::findPath/100x100", [&] {
+            doNotOptimize(bfs.findPath(grid, source, target));
+        });
+
+        ime::DFS dfs(grid.getSizeInTiles());
+        runner.run("DFS::findPath/100x100", [&] {
+            doNotOptimize(dfs.findPath(grid, source, target));
+        });
+    }
+}
@@ -0,0 +1,79 @@
+////////////////////////////////////////////////////////////////////////////////
+// IME - Infinite Motion Engine
+//
+// Copyright (c) 2020-2022 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Benchmark.h"
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+namespace {
+    void printUsage() {
+        std::cerr << "Usage: benchmarks [--filter <substring>] [--samples <count>] [--output <file.json>]\n";
+    }
+}
+
+// Runs the IME benchmarks and prints the results as JSON to the standard
+// output or to the file given with --output
+int main(int argc, char* argv[]) {
+    bench::Runner::Options options;
+    std::string outputFile;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (i + 1 < argc && arg == "--filter")
+            options.filter = argv[++i];
+        else if (i + 1 < argc && arg == "--samples")
+            options.sampleCount = static_cast<std::size_t>(std::strtoul(argv[++i], nullptr, 10));
+        else if (i + 1 < argc && arg == "--output")
+            outputFile = argv[++i];
+        else {
+            printUsage();
+            return EXIT_FAILURE;
+        }
+    }
+
+    bench::Runner runner(options);
+    bench::runEventEmitterBenchmarks(runner);
+    bench::runObjectContainerBenchmarks(runner);
+    bench::runGrid2DBenchmarks(runner);
+    bench::runPathFinderBenchmarks(runner);
+    bench::runAnimatorBenchmarks(runner);
+    bench::runTimerManagerBenchmarks(runner);
+    bench::runRenderLayerBenchmarks(runner);
+
+    if (outputFile.empty())
+        runner.writeJson(std::cout);
+    else {
+        std::ofstream file(outputFile);
+        if (!file) {
+            std::cerr << "Cannot open \"" << outputFile << "\" for writing\n";
+            return EXIT_FAILURE;
+        }
+
+        runner.writeJson(file);
+    }
+
+    return EXIT_SUCCESS;
+}
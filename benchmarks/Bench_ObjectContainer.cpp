@@ -0,0 +1,80 @@
+////////////////////////////////////////////////////////////////////////////////
+// IME - Infinite Motion Engine
+//
+// Copyright (c) 2020-2022 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Benchmark.h"
+#include "IME/core/object/Object.h"
+#include "IME/core/object/ObjectContainer.h"
+
+namespace bench {
+    namespace {
+        const std::size_t objectCount = 10000;
+
+        class BenchObject : public ime::Object {
+        public:
+            std::string getClassName() const override {
+                return "BenchObject";
+            }
+        };
+    }
+
+    void runObjectContainerBenchmarks(Runner& runner) {
+        ime::ObjectContainer<BenchObject> container;
+        std::vector<unsigned int> ids;
+        ids.reserve(objectCount);
+
+        for (std::size_t i = 0; i < objectCount; ++i) {
+            auto* object = container.addObject(std::make_unique<BenchObject>(), i % 2 == 0 ? "even" : "odd");
+            object->setTag("object" + std::to_string(i));
+            ids.push_back(object->getObjectId());
+        }
+
+        // Look up objects spread across the container
+        std::size_t next = 0;
+        runner.run("ObjectContainer::findById/10000", [&] {
+            doNotOptimize(container.findById(ids[next]));
+            next = (next + 997) % ids.size();
+        });
+
+        runner.run("ObjectContainer::findByTag/10000", [&] {
+            doNotOptimize(container.findByTag("object5000"));
+        });
+
+        runner.run("ObjectContainer::forEach/10000", [&] {
+            unsigned int sum = 0;
+            container.forEach([&sum](BenchObject* object) {
+                sum += object->getObjectId();
+            });
+
+            doNotOptimize(sum);
+        });
+
+        // The predicate matches nothing, so the container is left unchanged
+        // and the benchmark measures the cost of visiting every object
+        runner.run("ObjectContainer::removeIf/10000", [&] {
+            container.removeIf([](const BenchObject* object) {
+                return object->getObjectId() == 0;
+            });
+        });
+    }
+}
@@ -0,0 +1,49 @@
+////////////////////////////////////////////////////////////////////////////////
+// IME - Infinite Motion Engine
+//
+// Copyright (c) 2020-2022 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Benchmark.h"
+#include "IME/core/scene/Scene.h"
+#include "IME/graphics/Sprite.h"
+
+namespace bench {
+    void runRenderLayerBenchmarks(Runner& runner) {
+        for (int drawableCount : {100, 1000}) {
+            ime::Scene scene;
+            ime::RenderLayer::Ptr layer = scene.getRenderLayers().create("bench");
+
+            std::vector<std::unique_ptr<ime::Sprite>> sprites;
+            for (int i = 0; i < drawableCount; ++i) {
+                sprites.push_back(std::make_unique<ime::Sprite>());
+                layer->add(*sprites.back(), i % 10);
+            }
+
+            // Remove and re-add a drawable from the middle of the layer
+            ime::Sprite& sprite = *sprites[sprites.size() / 2];
+            runner.run("RenderLayer::add+remove/" + std::to_string(drawableCount), [&] {
+                layer->remove(sprite);
+                layer->add(sprite, 5);
+            });
+        }
+    }
+}
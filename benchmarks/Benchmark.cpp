@@ -0,0 +1,108 @@
+////////////////////////////////////////////////////////////////////////////////
+// IME - Infinite Motion Engine
+//
+// Copyright (c) 2020-2022 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Benchmark.h"
+#include "IME/Config.h"
+#include <algorithm>
+#include <iomanip>
+#include <numeric>
+#include <utility>
+
+namespace bench {
+    namespace {
+        // Escape the characters that are not allowed in a JSON string
+        std::string escapeJson(const std::string& str) {
+            std::string escaped;
+            for (char c : str) {
+                if (c == '"' || c == '\\')
+                    escaped += '\\';
+
+                escaped += c;
+            }
+
+            return escaped;
+        }
+    }
+
+    Runner::Runner(Options options) :
+        options_{std::move(options)}
+    {
+        if (options_.sampleCount == 0)
+            options_.sampleCount = 1;
+    }
+
+    bool Runner::isSelected(const std::string &name) const {
+        return options_.filter.empty() || name.find(options_.filter) != std::string::npos;
+    }
+
+    void Runner::record(const std::string &name, std::size_t iterations, const std::vector<ime::Time> &sampleTimes) {
+        std::vector<double> nsPerOperation;
+        nsPerOperation.reserve(sampleTimes.size());
+        for (const auto& time : sampleTimes)
+            nsPerOperation.push_back(static_cast<double>(time.asNanoseconds()) / static_cast<double>(iterations));
+
+        std::sort(nsPerOperation.begin(), nsPerOperation.end());
+
+        Result result;
+        result.name = name;
+        result.iterations = iterations;
+        result.samples = nsPerOperation.size();
+        result.minNs = nsPerOperation.front();
+        result.maxNs = nsPerOperation.back();
+        result.medianNs = nsPerOperation[nsPerOperation.size() / 2];
+        result.meanNs = std::accumulate(nsPerOperation.begin(), nsPerOperation.end(), 0.0) / static_cast<double>(nsPerOperation.size());
+        results_.push_back(result);
+    }
+
+    void Runner::writeJson(std::ostream &stream) const {
+        stream << "{\n";
+        stream << "  \"ime_version\": \"" << IME_VERSION_MAJOR << "." << IME_VERSION_MINOR << "." << IME_VERSION_PATCH << "\",\n";
+    #if defined(NDEBUG)
+        stream << "  \"build_type\": \"Release\",\n";
+    #else
+        stream << "  \"build_type\": \"Debug\",\n";
+    #endif
+        stream << "  \"benchmarks\": [";
+
+        stream << std::fixed << std::setprecision(3);
+        for (std::size_t i = 0; i < results_.size(); ++i) {
+            const Result& result = results_[i];
+            stream << (i == 0 ? "\n" : ",\n");
+            stream << "    {"
+                   << "\"name\": \"" << escapeJson(result.name) << "\", "
+                   << "\"iterations\": " << result.iterations << ", "
+                   << "\"samples\": " << result.samples << ", "
+                   << "\"min_ns\": " << result.minNs << ", "
+                   << "\"median_ns\": " << result.medianNs << ", "
+                   << "\"mean_ns\": " << result.meanNs << ", "
+                   << "\"max_ns\": " << result.maxNs << "}";
+        }
+
+        stream << "\n  ]\n}\n";
+    }
+
+    const std::vector<Result>& Runner::getResults() const {
+        return results_;
+    }
+}
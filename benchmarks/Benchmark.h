@@ -0,0 +1,173 @@
+////////////////////////////////////////////////////////////////////////////////
+// IME - Infinite Motion Engine
+//
+// Copyright (c) 2020-2022 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef IME_BENCHMARK_H
+#define IME_BENCHMARK_H
+
+#include "IME/core/time/Clock.h"
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace bench {
+    /**
+     * @brief Prevent the compiler from optimizing away a computed value
+     * @param value The value to be kept alive
+     */
+    template <typename T>
+    inline void doNotOptimize(const T& value) {
+    #if defined(_MSC_VER)
+        static const volatile void* sink = nullptr;
+        sink = &value;
+    #else
+        asm volatile("" : : "r,m"(value) : "memory");
+    #endif
+    }
+
+    /**
+     * @brief The measured cost of a single benchmark
+     */
+    struct Result {
+        std::string name;       //!< The name of the benchmark
+        std::size_t iterations; //!< The number of operations timed per sample
+        std::size_t samples;    //!< The number of samples taken
+        double minNs;           //!< The fastest sample in nanoseconds per operation
+        double medianNs;        //!< The median sample in nanoseconds per operation
+        double meanNs;          //!< The mean sample in nanoseconds per operation
+        double maxNs;           //!< The slowest sample in nanoseconds per operation
+    };
+
+    /**
+     * @brief Times benchmark operations and reports the results
+     *
+     * Each benchmark is first calibrated: the number of times the operation
+     * is executed per sample is doubled until a sample takes at least the
+     * minimum sample time. The operation is then timed for a fixed number
+     * of samples. Reporting the per-operation minimum and median of the
+     * samples makes the results robust against scheduler noise
+     */
+    class Runner {
+    public:
+        /**
+         * @brief Runner options
+         */
+        struct Options {
+            std::string filter;                                  //!< Only benchmarks whose name contains this string are run
+            std::size_t sampleCount = 15;                        //!< The number of samples per benchmark
+            ime::Time minSampleTime = ime::milliseconds(10);     //!< The minimum duration of a single sample
+        };
+
+        /**
+         * @brief Constructor
+         * @param options The runner options
+         */
+        explicit Runner(Options options);
+
+        /**
+         * @brief Time an operation
+         * @param name The name of the benchmark
+         * @param operation The operation to be timed
+         *
+         * The @a operation is called repeatedly and must leave its state
+         * such that it can be called again. Setup work must be done before
+         * calling this function so that it is not timed
+         */
+        template <typename Operation>
+        void run(const std::string& name, Operation&& operation);
+
+        /**
+         * @brief Write the results of all the benchmarks that were run as JSON
+         * @param stream The stream to write the results to
+         */
+        void writeJson(std::ostream& stream) const;
+
+        /**
+         * @brief Get the results of all the benchmarks that were run
+         * @return The benchmark results in the order they were run
+         */
+        const std::vector<Result>& getResults() const;
+
+    private:
+        /**
+         * @brief Check if a benchmark is selected by the filter
+         * @param name The name of the benchmark
+         * @return True if the benchmark should be run, otherwise false
+         */
+        bool isSelected(const std::string& name) const;
+
+        /**
+         * @brief Compute and store the result of a benchmark
+         * @param name The name of the benchmark
+         * @param iterations The number of operations per sample
+         * @param sampleTimes The duration of each sample
+         */
+        void record(const std::string& name, std::size_t iterations, const std::vector<ime::Time>& sampleTimes);
+
+    private:
+        Options options_;             //!< The runner options
+        std::vector<Result> results_; //!< The results of the benchmarks that were run
+    };
+
+    template <typename Operation>
+    void Runner::run(const std::string& name, Operation&& operation) {
+        if (!isSelected(name))
+            return;
+
+        auto timeIterations = [&operation](std::size_t iterations) {
+            ime::Clock clock;
+            for (std::size_t i = 0; i < iterations; ++i)
+                operation();
+
+            return clock.getElapsedTime();
+        };
+
+        // Warm up caches and lazily initialized state
+        operation();
+
+        std::size_t iterations = 1;
+        while (timeIterations(iterations) < options_.minSampleTime)
+            iterations *= 2;
+
+        std::vector<ime::Time> sampleTimes;
+        sampleTimes.reserve(options_.sampleCount);
+        for (std::size_t i = 0; i < options_.sampleCount; ++i)
+            sampleTimes.push_back(timeIterations(iterations));
+
+        record(name, iterations, sampleTimes);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Benchmark suites, each suite registers its benchmarks with the runner
+    ////////////////////////////////////////////////////////////////////////////
+    void runEventEmitterBenchmarks(Runner& runner);
+    void runObjectContainerBenchmarks(Runner& runner);
+    void runGrid2DBenchmarks(Runner& runner);
+    void runPathFinderBenchmarks(Runner& runner);
+    void runAnimatorBenchmarks(Runner& runner);
+    void runTimerManagerBenchmarks(Runner& runner);
+    void runRenderLayerBenchmarks(Runner& runner);
+}
+
+#endif // IME_BENCHMARK_H
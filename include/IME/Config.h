@@ -85,6 +85,9 @@
 // Portable macro that suppress unused parameter warnings
 #define IME_UNUSED(x) (void)(x)
 
+// Defined if event system statistics are collected (IME_ENABLE_EVENT_STATS CMake option)
+/* #undef IME_ENABLE_EVENT_STATS */
+
 // Define portable fixed-size types
 namespace ime {
     // All "common" platforms use the same size for char, short and int
@@ -35,21 +35,31 @@
 #include "IME/common/ITransformable.h"
 #include "IME/common/ITransformable.h"
 #include "IME/common/Property.h"
+#include "IME/common/PropertyChange.h"
 #include "IME/common/PropertyContainer.h"
 #include "IME/core/animation/Animation.h"
 #include "IME/core/animation/Animator.h"
 #include "IME/core/audio/SoundEffect.h"
 #include "IME/core/audio/Music.h"
 #include "IME/core/object/GameObject.h"
+#include "IME/core/object/GameObjectPool.h"
 #include "IME/core/event/Event.h"
 #include "IME/core/event/EventEmitter.h"
+#include "IME/core/event/EventKey.h"
 #include "IME/core/event/EventDispatcher.h"
+#include "IME/core/event/EventMask.h"
+#include "IME/core/event/EventBatch.h"
 #include "IME/core/exceptions/Exceptions.h"
 #include "IME/core/input/InputManager.h"
 #include "IME/core/input/Mouse.h"
 #include "IME/core/input/Keyboard.h"
 #include "IME/core/input/Joystick.h"
 #include "IME/core/engine/Engine.h"
+#include "IME/core/engine/FrameProfiler.h"
+#include "IME/core/engine/JobSystem.h"
+#include "IME/core/engine/FramePacer.h"
+#include "IME/core/engine/SessionRecorder.h"
+#include "IME/core/engine/SessionPlayer.h"
 #include "IME/core/physics/grid/path/BFS.h"
 #include "IME/core/physics/grid/path/DFS.h"
 #include "IME/core/physics/rigid_body/AABB.h"
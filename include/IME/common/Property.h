@@ -102,6 +102,17 @@ namespace ime {
          */
         bool hasValue() const;
 
+        /**
+         * @brief Get the value of the property if it is of a given type
+         * @return A pointer to the value or a nullptr if the property does
+         *         not have a value of type T
+         *
+         * Unlike getValue(), this function does not copy the value and does
+         * not throw if the value is of a different type
+         */
+        template<typename T>
+        const T* getValueIf() const;
+
         /**
          * @brief Subscribe a callback to a value change event
          * @param callback The function to be executed when the value changes
@@ -128,7 +139,7 @@ namespace ime {
     private:
         std::string name_;      //!< Name of the property
         std::any value_;        //!< Value of the property
-        EventEmitter emitter_;  //!< Dispatches value change events
+        EventEmitter emitter_{EventEmitter::ThreadingPolicy::SingleThreaded};  //!< Dispatches value change events
     };
 
     #include "IME/common/Property.inl"
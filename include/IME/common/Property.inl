@@ -34,6 +34,11 @@ void Property::setValue(T&& value) {
     emitter_.emit("valueChange", this);
 }
 
+template<typename T>
+const T* Property::getValueIf() const {
+    return std::any_cast<T>(&value_);
+}
+
 template<typename T>
 T Property::getValue() const {
     try {
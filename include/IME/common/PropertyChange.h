@@ -0,0 +1,159 @@
+////////////////////////////////////////////////////////////////////////////////
+// IME - Infinite Motion Engine
+//
+// Copyright (c) 2020-2022 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef IME_PROPERTYCHANGE_H
+#define IME_PROPERTYCHANGE_H
+
+#include "IME/Config.h"
+#include "IME/common/Vector2.h"
+#include "IME/core/event/EventKey.h"
+#include "IME/core/grid/Index.h"
+#include <string_view>
+#include <type_traits>
+#include <typeinfo>
+#include <variant>
+
+namespace ime {
+    /**
+     * @brief A reference to a property value of any type
+     *
+     * This is the alternative of ime::PropertyValue for values whose type
+     * is not one of the other alternatives, such as pointers, colours and
+     * rectangles. Like the notification it belongs to, it is only valid
+     * for the duration of the callback that it is passed to.
+     *
+     * A change that is emitted as an ime::Property whose value is not of
+     * an alternative type refers to the ime::Property itself
+     *
+     * @code
+     * if (const auto* target = std::get<ime::AnyPropertyValue>(change.value).get<ime::GridObject*>())
+     *     ...
+     * @endcode
+     */
+    class AnyPropertyValue {
+    public:
+        /**
+         * @brief Constructor
+         * @param value The value to refer to
+         */
+        template <typename T>
+        explicit AnyPropertyValue(const T& value) :
+            value_{&value},
+            type_{&typeid(T)}
+        {}
+
+        /**
+         * @brief Check if the value is of a given type
+         * @return True if the value is of type T, otherwise false
+         */
+        template <typename T>
+        bool is() const {
+            return *type_ == typeid(T);
+        }
+
+        /**
+         * @brief Get the value
+         * @return A pointer to the value or a nullptr if the value is not
+         *         of type T
+         */
+        template <typename T>
+        const T* get() const {
+            return is<T>() ? static_cast<const T*>(value_) : nullptr;
+        }
+
+    private:
+        const void* value_;           //!< The referred value
+        const std::type_info* type_;  //!< The type of the referred value
+    };
+
+    /**
+     * @brief The value of a property in a property change notification
+     *
+     * Enumerations are stored as int and values of any other type that is
+     * not an alternative are referred to by an ime::AnyPropertyValue.
+     * std::monostate is used for properties that do not have a value
+     */
+    using PropertyValue = std::variant<std::monostate, bool, int, unsigned int,
+        float, std::string_view, Vector2f, Vector2i, Index, AnyPropertyValue>;
+
+    /**
+     * @brief A notification of a property change
+     *
+     * Unlike ime::Property, a property change notification does not
+     * own its name or its value, therefore constructing one does not
+     * allocate. It is only valid for the duration of the callback that
+     * it is passed to
+     */
+    struct PropertyChange {
+        /**
+         * @brief Get the id of a property
+         * @param name The name of the property
+         * @return The id of the property
+         *
+         * The id is a hash of the name that can be computed at compile time,
+         * such that changes can be told apart with a switch statement:
+         *
+         * @code
+         * switch (change.id) {
+         *     case ime::PropertyChange::idOf("position"):
+         *         ...
+         * }
+         * @endcode
+         */
+        static constexpr Uint64 idOf(std::string_view name) {
+            return EventKey::computeHash(name);
+        }
+
+        Uint64 id;             //!< The id of the property that changed
+        std::string_view name; //!< The name of the property that changed
+        PropertyValue value;   //!< The new value of the property
+    };
+
+    /**
+     * @brief Convert a value to a property value
+     * @param value The value to be converted
+     * @return The property value
+     *
+     * Enumerations are converted to int and strings to std::string_view.
+     * Values whose type is not an alternative of ime::PropertyValue are
+     * referred to by an ime::AnyPropertyValue, @a value must therefore
+     * outlive the returned property value
+     */
+    template <typename T>
+    PropertyValue makePropertyValue(const T& value) {
+        if constexpr (std::is_same_v<T, bool> || std::is_same_v<T, int> || std::is_same_v<T, unsigned int>
+            || std::is_same_v<T, float> || std::is_same_v<T, Vector2f> || std::is_same_v<T, Vector2i>
+            || std::is_same_v<T, Index>)
+        {
+            return PropertyValue{std::in_place_type<T>, value};
+        } else if constexpr (std::is_enum_v<T>)
+            return PropertyValue{std::in_place_type<int>, static_cast<int>(value)};
+        else if constexpr (std::is_convertible_v<const T&, std::string_view>)
+            return PropertyValue{std::in_place_type<std::string_view>, std::string_view(value)};
+        else
+            return PropertyValue{std::in_place_type<AnyPropertyValue>, value};
+    }
+}
+
+#endif // IME_PROPERTYCHANGE_H
@@ -210,6 +210,146 @@ namespace ime {
          */
         void move(const Vector2f& offset);
 
+        /**
+         * @brief Enable or disable render interpolation
+         * @param interpolate True to enable or false to disable
+         *
+         * Objects that are moved by a fixed update (physics bodies and grid
+         * movers) only change their position at the fixed update rate. When
+         * the fixed update rate is lower than the render frame rate, their
+         * movement appears jerky. When interpolation is enabled, the object
+         * is rendered between its previous and current fixed update states
+         * instead, see ime::Engine::getFixedUpdateAlpha
+         *
+         * Note that interpolation only affects how the object is rendered,
+         * getPosition() and getRotation() always return the simulated state.
+         * When interpolation is disabled, a 'position' and a 'rotation'
+         * change event are triggered such that the object is rendered at
+         * its current state again, even if the transform is deferred
+         *
+         * By default, interpolation is disabled
+         *
+         * @see isInterpolationEnabled
+         */
+        void setInterpolationEnabled(bool interpolate);
+
+        /**
+         * @brief Check if render interpolation is enabled or not
+         * @return True if enabled, otherwise false
+         *
+         * @see setInterpolationEnabled
+         */
+        bool isInterpolationEnabled() const;
+
+        /**
+         * @brief Get the position between the previous and current state
+         * @param alpha The interpolation factor in the range [0, 1]
+         * @return The interpolated position
+         *
+         * If interpolation is disabled, this function returns the current
+         * position
+         *
+         * @see setInterpolationEnabled
+         */
+        Vector2f getInterpolatedPosition(float alpha) const;
+
+        /**
+         * @brief Get the rotation between the previous and current state
+         * @param alpha The interpolation factor in the range [0, 1]
+         * @return The interpolated rotation, in degrees
+         *
+         * The rotation is interpolated along the shortest arc. If
+         * interpolation is disabled, this function returns the current
+         * rotation
+         *
+         * @see setInterpolationEnabled
+         */
+        float getInterpolatedRotation(float alpha) const;
+
+        /**
+         * @internal
+         * @brief Save the current position and rotation as the previous state
+         *
+         * @warning This function is called internally by IME before each
+         * fixed update, do not call it directly
+         */
+        void savePreviousState();
+
+        /**
+         * @brief Enable or disable deferred change notifications
+         * @param deferred True to defer notifications or false to send them
+         *                 immediately
+         *
+         * By default, every call to a setter that changes the position,
+         * rotation, scale or origin immediately notifies the property
+         * change listeners. When a transform is modified several times
+         * per frame and its listeners are expensive (for example a game
+         * object which updates its sprite and rigid body), deferring the
+         * notifications is cheaper: the setters only record which
+         * properties changed and flushChanges() then notifies the
+         * listeners once per changed property with its final value
+         *
+         * The transform of an ime::GameObject that belongs to a scene is
+         * flushed by the scene before each physics step and before it is
+         * rendered. Note that while a change is pending, the objects sprite,
+         * rigid body and property change listeners still see the previous
+         * value
+         *
+         * Disabling deferred notifications flushes pending changes
+         *
+         * @see isDeferredSyncEnabled, flushChanges
+         */
+        void setDeferredSyncEnabled(bool deferred);
+
+        /**
+         * @brief Check if change notifications are deferred or not
+         * @return True if deferred, otherwise false
+         *
+         * @see setDeferredSyncEnabled
+         */
+        bool isDeferredSyncEnabled() const;
+
+        /**
+         * @brief Check if the transform has changes that have not been
+         *        flushed yet
+         * @return True if there are pending changes, otherwise false
+         *
+         * This function always returns false if deferred notifications are
+         * disabled
+         *
+         * @see setDeferredSyncEnabled, flushChanges
+         */
+        bool isDirty() const;
+
+        /**
+         * @brief Notify property change listeners of pending changes
+         *
+         * Listeners are notified once for each property that changed since
+         * the last flush, in the order position, rotation, scale and origin.
+         * This function does nothing if there are no pending changes
+         *
+         * @see setDeferredSyncEnabled
+         */
+        void flushChanges();
+
+        /**
+         * @brief Add an event listener to a deferred change
+         * @param callback The function to be executed when the transform
+         *                 becomes dirty
+         * @param oneTime True to execute the callback one-time or false to
+         *                execute it every time the event is triggered
+         * @return The event listeners identification number
+         *
+         * The callback is invoked when a property of a transform that
+         * defers its change notifications changes while the transform has
+         * no pending changes. That is, at most once between two flushes.
+         * This allows the pending changes of many transforms to be flushed
+         * without checking each of them
+         *
+         * @see unsubscribe, setDeferredSyncEnabled and flushChanges
+         */
+        int onDirty(const Callback<>& callback, bool oneTime = false);
+
         /**
          * @brief Add an event listener to a property change event
          * @param callback The function to be executed when a property changes
@@ -254,16 +394,31 @@ namespace ime {
          * @return True if the event listener was removed or false if no such
          *         event listener exists
          *
-         * @see onPropertyChange
+         * @see onPropertyChange and onDirty
          */
         bool unsubscribe(int id);
 
+    private:
+        /**
+         * @brief Record a pending change
+         * @param flag The property that changed
+         *
+         * The dirty listeners are notified if the transform had no pending
+         * changes
+         */
+        void markDirty(Uint8 flag);
+
     private:
         Vector2f position_; //!< Position of the object in the 2D world
         Vector2f scale_;    //!< Scale of the object
         Vector2f origin_;   //!< Origin of translation/rotation/scaling of the object
         float rotation_;    //!< Orientation of the object, in degrees
-        EventEmitter eventEmitter_; //!< Dispatches property change events
+        Vector2f prevPosition_; //!< Position of the object at the previous fixed update
+        float prevRotation_;    //!< Orientation of the object at the previous fixed update
+        bool isInterpolated_;   //!< A flag indicating whether or not the object is rendered at an interpolated state
+        bool isDeferred_;       //!< A flag indicating whether or not change notifications are deferred
+        Uint8 dirtyFlags_;      //!< Properties that changed since the last flush
+        EventEmitter eventEmitter_{EventEmitter::ThreadingPolicy::SingleThreaded}; //!< Dispatches property change events
     };
 }
 
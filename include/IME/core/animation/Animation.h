@@ -763,7 +763,7 @@ namespace ime {
          * @warning This function is intended for internal use only and
          * must not be called outside of IME
          */
-        void emit(const std::string& event);
+        void emit(const EventKey& event);
 
         /**
          * @internal
@@ -813,7 +813,7 @@ namespace ime {
         int completionFrame_;       //!< The index of the frame to be shown when the animation finishes
         unsigned int currentFrameIndex_; //!< The index of the current frame displayed by the animation
         float timescale_;           //!< Playback speed of the animation
-        EventEmitter eventEmitter_; //!< Dispatches events
+        EventEmitter eventEmitter_{EventEmitter::ThreadingPolicy::SingleThreaded}; //!< Dispatches events
     };
 }
 
@@ -663,7 +663,7 @@ namespace ime {
         bool isPlaying_;                                             //!< A flag indicating whether or not an animation is playing
         bool isPaused_;                                              //!< A flag indicating whether or not an animation is paused
         bool hasStarted_;                                            //!< A flag indicating whether or not a playing animation has started or is still waiting for a delay to expire
-        EventEmitter eventEmitter_;                                  //!< Publishes animation events
+        EventEmitter eventEmitter_{EventEmitter::ThreadingPolicy::SingleThreaded}; //!< Publishes animation events
         Animation::Ptr currentAnimation_;                            //!< Pointer to the current animation
         std::queue<Animation::Ptr> chains_;                          //!< Animations that play immediately after the current animation finishes
         std::unique_ptr<std::reference_wrapper<Sprite>> target_;     //!< Sprite to be animated
@@ -34,6 +34,14 @@
 #include "IME/common/PrefContainer.h"
 #include "IME/core/scene/Scene.h"
 #include "IME/core/time/Timer.h"
+#include "IME/core/time/Clock.h"
+#include "IME/core/engine/FrameProfiler.h"
+#include "IME/core/engine/JobSystem.h"
+#include "IME/core/engine/FramePacer.h"
+#include "IME/core/engine/SessionRecorder.h"
+#include "IME/core/engine/SessionPlayer.h"
+#include "IME/core/event/EventBatch.h"
+#include "IME/core/event/EventStats.h"
 #include "IME/graphics/WindowStyles.h"
 #include "IME/graphics/Window.h"
 #include <queue>
@@ -44,6 +52,9 @@ namespace ime {
     namespace priv {
         class SceneManager;
         class RenderTarget;
+        class RenderSnapshot;
+        class WorkerThread;
+        class EventStatsCollector;
     }
 
     /// @internal
@@ -182,6 +193,202 @@ namespace ime {
          */
         unsigned int getPhysicsUpdateFrameRate() const;
 
+        /**
+         * @brief Get the progress of the current frame towards the next
+         *        fixed update
+         * @return The interpolation factor in the range [0, 1)
+         *
+         * Fixed updates are performed in whole timesteps, the time left
+         * over after the last fixed update of a frame is carried over to
+         * the next frame. This function returns the left over time as a
+         * fraction of the fixed timestep. It can be used to render objects
+         * between their previous and current fixed update states, which
+         * keeps movement smooth when the physics update frame rate is lower
+         * than the render frame rate
+         *
+         * @see setPhysicsUpdateFrameRate, ime::Transform::setInterpolationEnabled
+         */
+        float getFixedUpdateAlpha() const;
+
+        /**
+         * @brief Check if the engine runs without a window
+         * @return True if the engine is headless, otherwise false
+         *
+         * A headless engine does not create a render window or a gui. It
+         * still updates the active scene (timers, grid movers, physics etc..)
+         * but it does not poll system events and it does not render anything.
+         * This is useful for simulation servers and benchmarks that must run
+         * on machines without a display
+         *
+         * The engine is made headless by setting the @a HEADLESS preference
+         * to true before the engine is initialized:
+         *
+         * @code
+         * ime::PrefContainer settings;
+         * settings.addPref({"HEADLESS", ime::PrefType::Bool, true});
+         *
+         * ime::Engine engine{"Simulation server", settings};
+         * engine.setFixedDeltaTime(ime::seconds(1.0f / 60.0f));
+         * engine.initialize();
+         * @endcode
+         *
+         * @note A headless engine does not limit its frame rate, it runs
+         * as fast as the machine allows
+         *
+         * @see setFixedDeltaTime, setDeltaTimeSource
+         */
+        bool isHeadless() const;
+
+        /**
+         * @brief Check if the engine updates and renders in parallel
+         * @return True if rendering is pipelined, otherwise false
+         *
+         * When rendering is pipelined, the scene is updated for the next
+         * frame on a worker thread while the main thread draws the current
+         * frame. To make this possible, the drawables of the scene (sprites,
+         * shapes, tiles etc..) are copied into a snapshot at the end of each
+         * update and the snapshot is drawn in the following frame. The gui
+         * is not part of the snapshot, it is drawn after the update completes.
+         * Pipelined rendering overlaps the cost of the update with the cost
+         * of submitting draw calls at the expense of one frame of latency
+         *
+         * Rendering is pipelined by setting the @a PIPELINED_RENDERING
+         * preference to true before the engine is initialized. The setting
+         * has no effect on a headless engine
+         *
+         * @warning When rendering is pipelined, scene update and render
+         * callbacks (ime::Scene::onUpdate, ime::Scene::onPreRender etc..) are
+         * executed on the worker thread, they must not call functions that
+         * require the window thread such as ime::Window::close. This is
+         * asserted in debug builds. Textures drawn by a recorded frame are
+         * kept alive by its snapshot until the frame is drawn
+         *
+         * By default, rendering is not pipelined
+         */
+        bool isRenderPipelined() const;
+
+        /**
+         * @brief Enable or disable system event coalescing
+         * @param enable True to enable coalescing, otherwise false
+         *
+         * When enabled, consecutive mouse move events polled in the same
+         * frame are merged into the most recent one before they are
+         * dispatched. The same applies to consecutive joystick move events
+         * of the same joystick axis. This reduces the amount of work done
+         * by listeners when the mouse or a joystick generates many events
+         * per frame, at the cost of the intermediate positions
+         *
+         * By default, events are not coalesced
+         *
+         * @see isEventCoalescingEnabled
+         */
+        void setEventCoalescingEnabled(bool enable);
+
+        /**
+         * @brief Check if system events are coalesced or not
+         * @return True if events are coalesced, otherwise false
+         *
+         * @see setEventCoalescingEnabled
+         */
+        bool isEventCoalescingEnabled() const;
+
+        /**
+         * @brief Start recording the session
+         * @param filename The name of the file to record the session to
+         * @throws FileNotFoundException If @a filename cannot be opened for writing
+         *
+         * From the next frame onwards, the delta time and the system events
+         * dispatched in each frame are recorded to @a filename until the
+         * recording is stopped or the engine shuts down. The recording can
+         * then be played back by setting the @a REPLAY_FILE preference:
+         *
+         * @code
+         * ime::PrefContainer settings;
+         * settings.addPref({"REPLAY_FILE", ime::PrefType::String, std::string("session.imes")});
+         *
+         * ime::Engine engine{"Replay", settings};
+         * engine.initialize();
+         * @endcode
+         *
+         * When a replay file is set, the engine runs headless (see isHeadless)
+         * and, instead of polling the system and measuring the time that
+         * passed between frames, it takes both from the recording. The
+         * frames are executed as fast as possible and the engine stops when
+         * the recording runs out of frames. Since the game receives exactly
+         * the same input, replaying the same recording on two builds of a
+         * game and comparing their frame profiles (see getFrameProfiler)
+         * exposes performance regressions
+         *
+         * @note Since a replay is headless, gui widgets do not receive the
+         * recorded events
+         *
+         * @see stopRecording, isRecording, isReplaying
+         */
+        void startRecording(const std::string& filename);
+
+        /**
+         * @brief Stop recording the session
+         *
+         * @see startRecording
+         */
+        void stopRecording();
+
+        /**
+         * @brief Check if the session is being recorded or not
+         * @return True if the session is being recorded, otherwise false
+         *
+         * @see startRecording
+         */
+        bool isRecording() const;
+
+        /**
+         * @brief Check if the engine is replaying a recorded session
+         * @return True if the engine is replaying a session, otherwise false
+         *
+         * @see startRecording
+         */
+        bool isReplaying() const;
+
+        /**
+         * @brief Set a fixed frame delta time
+         * @param deltaTime The time to advance the game by each frame
+         *
+         * When set, the engine ignores the time that actually passed
+         * between frames and advances the game by @a deltaTime every frame.
+         * This makes the simulation deterministic and allows a headless
+         * engine to run faster than real time. Pass ime::Time::Zero to
+         * measure the frame time using the system clock
+         *
+         * By default, the delta time is measured using the system clock
+         *
+         * @see getFixedDeltaTime, setDeltaTimeSource
+         */
+        void setFixedDeltaTime(const Time& deltaTime);
+
+        /**
+         * @brief Get the fixed frame delta time
+         * @return The fixed frame delta time or ime::Time::Zero if the delta
+         *         time is measured using the system clock
+         *
+         * @see setFixedDeltaTime
+         */
+        Time getFixedDeltaTime() const;
+
+        /**
+         * @brief Set a function that supplies the frame delta time
+         * @param source Function to be invoked at the start of each frame
+         *
+         * The @a source is invoked once per frame and its return value is
+         * used as the frame delta time. It takes precedence over the fixed
+         * delta time (see setFixedDeltaTime()). Pass @a nullptr to remove
+         * the source
+         *
+         * By default, there is no delta time source
+         *
+         * @see setFixedDeltaTime
+         */
+        void setDeltaTimeSource(const std::function<Time()>& source);
+
          /**
           * @brief Get the engines settings
           * @return The engines settings
@@ -428,6 +635,85 @@ namespace ime {
          */
         Time getElapsedTime() const;
 
+        /**
+         * @brief Get the engines frame profiler
+         * @return The engines frame profiler
+         *
+         * The profiler records the duration of each phase of the last N
+         * frames, see ime::FramePhase. It is enabled by default and it can
+         * be used to configure the number of frames to keep records of
+         *
+         * @see getFrameStats
+         */
+        FrameProfiler& getFrameProfiler();
+        const FrameProfiler& getFrameProfiler() const;
+
+        /**
+         * @brief Get timing statistics of the most recent frames
+         * @return The min, max, average, p95 and p99 times of each frame
+         *         phase and the number of fixed updates per frame
+         *
+         * This function is a shortcut for:
+         *
+         * @code
+         * engine.getFrameProfiler().computeStats();
+         * @endcode
+         *
+         * @see getFrameProfiler
+         */
+        FrameStats getFrameStats() const;
+
+        /**
+         * @brief Get event system statistics of the last frame
+         * @return The emit counts, listener counts and dispatch times of
+         *         the events emitted in the last frame
+         *
+         * The statistics cover every event emitter (including the ones
+         * used internally by IME) and queued events dispatched by the
+         * ime::EventDispatcher. Events are sorted by dispatch time, the
+         * most expensive first:
+         *
+         * @code
+         * for (const ime::EventStats::Entry& entry : engine.getEventStats().events)
+         *     std::cout << entry.name << ": " << entry.emitCount << " emits, "
+         *               << entry.dispatchTime.asMicroseconds() << "us" << std::endl;
+         * @endcode
+         *
+         * @note The statistics are only collected if IME is built with the
+         * IME_ENABLE_EVENT_STATS CMake option, otherwise they are always
+         * empty, see ime::EventStats::isEnabled
+         */
+        const EventStats& getEventStats() const;
+
+        /**
+         * @brief Get the engines job system
+         * @return The engines job system
+         *
+         * The job system executes expensive tasks (AI, path finding, procedural
+         * generation etc..) on worker threads. Functions passed to
+         * ime::JobSystem::runOnMainThread are executed at the end of the
+         * frame in which they were passed. When the engine is shutdown, it
+         * waits for all running jobs to complete
+         *
+         * @see ime::Scene::getJobSystem
+         */
+        JobSystem& getJobSystem();
+        const JobSystem& getJobSystem() const;
+
+        /**
+         * @brief Get the engines frame pacer
+         * @return The engines frame pacer
+         *
+         * The frame pacer is configured using the @a FRAME_PACING preference
+         * when the engine is initialized. When its limiter is enabled, the
+         * frame rate limit of the window (see ime::Window::setFrameRateLimit)
+         * is enforced by the frame pacer instead of the window
+         *
+         * @see ime::FramePacer
+         */
+        FramePacer& getFramePacer();
+        const FramePacer& getFramePacer() const;
+
         /**
          * @brief Get the engines game window
          * @return The engines game window
@@ -655,11 +941,44 @@ namespace ime {
          */
         void initResourceManager();
 
+        /**
+         * @brief Initialize the frame pacer
+         */
+        void initFramePacer();
+
+        /**
+         * @brief Get the delta time of the current frame
+         * @param gameClock The clock that measures the frame time
+         * @return The delta time of the current frame
+         */
+        Time computeDeltaTime(Clock& gameClock);
+
+        /**
+         * @brief Update the next frame while the current frame is rendered
+         * @param deltaTime Time passed since last frame update
+         *
+         * @see isRenderPipelined
+         */
+        void updateAndRenderPipelined(Time deltaTime);
+
+        /**
+         * @brief Record the drawables of the current scene into a snapshot
+         *
+         * The snapshot is drawn by the next call to updateAndRenderPipelined()
+         */
+        void captureRenderState();
+
         /**
          * @brief Process events for the current frame
          */
         void processEvents();
 
+        /**
+         * @brief Dispatch the events of the current frame to the engine,
+         *        the gui and the active scene
+         */
+        void dispatchEvents();
+
         /**
          * @brief Pre-update current frame
          * @param deltaTime Time passed since last pre-update
@@ -707,8 +1026,30 @@ namespace ime {
         bool isInitialized_;                               //!< A flag indicating whether or not the engine has been initialized
         bool isRunning_;                                   //!< A flag indicating whether or not the engine is running
         bool isPaused_;                                    //!< A flag indicating whether or not the engine is paused
+        bool isHeadless_;                                  //!< A flag indicating whether or not the engine runs without a window
+        bool isRenderPipelined_;                           //!< A flag indicating whether or not the next frame is updated while the current frame is rendered
+        bool isEventCoalescingEnabled_;                    //!< A flag indicating whether or not redundant move events are merged before dispatch
+        bool isReplaying_;                                 //!< A flag indicating whether or not the engine plays back a recorded session
         unsigned int fixedUpdateFPS_;                      //!< The frame rate of a fixed update
         Time elapsedTime_;                                 //!< The time passed since the engine started running
+        Time fixedUpdateAccumulator_;                      //!< The time not yet consumed by fixed updates
+        Time fixedDeltaTime_;                              //!< The time the game is advanced by each frame (Time::Zero = use system clock)
+        std::function<Time()> deltaTimeSource_;            //!< Optional function that supplies the frame delta time
+        FrameProfiler frameProfiler_;                      //!< Records the duration of each phase of the most recent frames
+        EventStats eventStats_;                            //!< Event system statistics of the last frame
+        std::unique_ptr<priv::EventQueue> eventQueue_;     //!< Events posted for this engine by its threads and jobs
+        std::unique_ptr<priv::EventStatsCollector> eventStatsCollector_; //!< Records the emits of the threads and jobs of this engine
+        JobSystem jobSystem_;                              //!< Executes jobs on worker threads
+        FramePacer framePacer_;                            //!< Limits the frame rate and smooths the frame delta time
+        EventBatch eventBatch_;                            //!< The system events polled in the current frame
+        SessionRecorder sessionRecorder_;                  //!< Records the delta time and events of each frame
+        SessionPlayer sessionPlayer_;                      //!< Plays back a recorded session
+        Time replayDeltaTime_;                             //!< The delta time of the current frame of a replay
+        std::unique_ptr<priv::WorkerThread> simulationThread_; //!< Updates the next frame when rendering is pipelined
+        std::unique_ptr<priv::RenderSnapshot> frontSnapshot_;  //!< Snapshot drawn by the current frame when rendering is pipelined
+        std::unique_ptr<priv::RenderSnapshot> backSnapshot_;   //!< Snapshot recorded by the current frame when rendering is pipelined
+        Time simulationFixedUpdateTime_;                   //!< The duration of the fixed updates performed by the simulation thread
+        Time simulationUpdateTime_;                        //!< The duration of the update and render recording performed by the simulation thread
         EventEmitter eventEmitter_;                        //!< Emits engine events
         std::unique_ptr<priv::SceneManager> sceneManager_; //!< The scene manager
         audio::AudioManager audioManager_;                 //!< The engine level audio manager
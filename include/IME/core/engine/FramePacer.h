@@ -0,0 +1,194 @@
+////////////////////////////////////////////////////////////////////////////////
+// IME - Infinite Motion Engine
+//
+// Copyright (c) 2020-2022 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef IME_FRAMEPACER_H
+#define IME_FRAMEPACER_H
+
+#include "IME/Config.h"
+#include "IME/core/time/Time.h"
+#include <chrono>
+#include <vector>
+
+namespace ime {
+    /**
+     * @brief Limits the frame rate precisely and smooths the frame delta time
+     *
+     * This class is not meant to be instantiated directly, use
+     * ime::Engine::getFramePacer
+     */
+    class IME_API FramePacer {
+    public:
+        /**
+         * @brief Constructor
+         */
+        FramePacer();
+
+        /**
+         * @brief Enable or disable the frame rate limiter
+         * @param enable True to enable or false to disable
+         *
+         * When enabled, waitForNextFrame() blocks until it is time to
+         * start the next frame. The wait sleeps for most of the remaining
+         * time and spins for the rest of it, since operating system sleeps
+         * may overshoot by a few milliseconds
+         *
+         * By default, the limiter is disabled
+         *
+         * @see setFrameRateLimit and setSpinThreshold
+         */
+        void setLimiterEnabled(bool enable);
+
+        /**
+         * @brief Check if the frame rate limiter is enabled or not
+         * @return True if enabled, otherwise false
+         */
+        bool isLimiterEnabled() const;
+
+        /**
+         * @brief Set the maximum number of frames per second
+         * @param limit The new frame rate limit (0 means no limit)
+         *
+         * By default, the limit is 60 frames per second
+         */
+        void setFrameRateLimit(unsigned int limit);
+
+        /**
+         * @brief Get the maximum number of frames per second
+         * @return The frame rate limit
+         */
+        unsigned int getFrameRateLimit() const;
+
+        /**
+         * @brief Set the time to busy wait at the end of each frame
+         * @param threshold The time to spin instead of sleeping
+         *
+         * A larger threshold improves the precision of the limiter at the
+         * cost of more CPU usage. By default, the threshold is 2 ms
+         */
+        void setSpinThreshold(const Time& threshold);
+
+        /**
+         * @brief Get the time to busy wait at the end of each frame
+         * @return The time to spin instead of sleeping
+         */
+        Time getSpinThreshold() const;
+
+        /**
+         * @brief Enable or disable frame delta time smoothing
+         * @param enable True to enable or false to disable
+         *
+         * When enabled, smooth() returns the median of the most recent
+         * delta times instead of the latest one. This removes isolated
+         * spikes (caused by the OS scheduler, for example) that would
+         * otherwise make motion stutter
+         *
+         * By default, smoothing is disabled
+         *
+         * @see setSmoothingWindow
+         */
+        void setSmoothingEnabled(bool enable);
+
+        /**
+         * @brief Check if frame delta time smoothing is enabled or not
+         * @return True if enabled, otherwise false
+         */
+        bool isSmoothingEnabled() const;
+
+        /**
+         * @brief Set the number of frames the delta time is smoothed over
+         * @param frameCount The number of frames (at least 1)
+         *
+         * By default, the delta time is smoothed over 5 frames
+         */
+        void setSmoothingWindow(std::size_t frameCount);
+
+        /**
+         * @brief Get the number of frames the delta time is smoothed over
+         * @return The number of frames
+         */
+        std::size_t getSmoothingWindow() const;
+
+        /**
+         * @brief Smooth a measured frame delta time
+         * @param deltaTime The measured delta time of the current frame
+         * @return The smoothed delta time or @a deltaTime if smoothing
+         *         is disabled
+         */
+        Time smooth(const Time& deltaTime);
+
+        /**
+         * @brief Block until the next frame is due
+         *
+         * This function does nothing if the limiter is disabled. When a
+         * frame takes longer than the frame rate limit allows, the next
+         * frame starts immediately and the schedule is restarted from it,
+         * rather than rushing through frames to catch up
+         */
+        void waitForNextFrame();
+
+        /**
+         * @brief Discard the frame schedule and the smoothing history
+         */
+        void reset();
+
+    private:
+        using Clock = std::chrono::steady_clock;
+
+        bool isLimiterEnabled_;             //!< A flag indicating whether or not the frame rate is limited
+        bool isSmoothingEnabled_;           //!< A flag indicating whether or not the delta time is smoothed
+        unsigned int frameRateLimit_;       //!< The maximum number of frames per second
+        Time spinThreshold_;                //!< The time to spin instead of sleeping
+        Clock::time_point nextFrame_;       //!< The time at which the next frame is due
+        bool isScheduled_;                  //!< A flag indicating whether or not nextFrame_ is valid
+        std::vector<Time> samples_;         //!< Most recent delta times
+        std::vector<Time> sortedSamples_;   //!< Scratch buffer used to find the median
+        std::size_t smoothingWindow_;       //!< The number of samples to smooth over
+        std::size_t nextSample_;            //!< The index of the next sample to replace
+    };
+}
+
+/**
+ * @class ime::FramePacer
+ * @ingroup core
+ *
+ * The engine configures its frame pacer using the @a FRAME_PACING
+ * preference, which takes one of the following values:
+ *
+ * - "Default": The frame rate is limited by the window (using operating
+ *              system sleeps) and the measured delta time is used as is
+ * - "Precise": The frame rate is limited by the frame pacer
+ * - "Smooth": Same as "Default" but the delta time is smoothed
+ * - "PreciseSmooth": Combines "Precise" and "Smooth"
+ *
+ * @code
+ * ime::PrefContainer settings;
+ * settings.addPref({"FRAME_PACING", ime::PrefType::String, std::string("PreciseSmooth")});
+ * settings.addPref({"FPS_LIMIT", ime::PrefType::Int, 144});
+ * @endcode
+ *
+ * Note that smoothing only applies to delta times measured by the
+ * system clock, see ime::Engine::setFixedDeltaTime
+ */
+
+#endif // IME_FRAMEPACER_H
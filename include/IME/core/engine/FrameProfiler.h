@@ -0,0 +1,281 @@
+////////////////////////////////////////////////////////////////////////////////
+// IME - Infinite Motion Engine
+//
+// Copyright (c) 2020-2022 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef IME_FRAMEPROFILER_H
+#define IME_FRAMEPROFILER_H
+
+#include "IME/Config.h"
+#include "IME/core/time/Time.h"
+#include <array>
+#include <chrono>
+#include <vector>
+
+namespace ime {
+    /**
+     * @brief The phases of a single engine frame
+     */
+    enum class FramePhase {
+        PreUpdate = 0,   //!< Scene pre-update (including frame start listeners)
+        ProcessEvents,   //!< System event polling and dispatch
+        FixedUpdate,     //!< Fixed timestep update loop (physics, grid movers)
+        Update,          //!< Variable timestep update
+        Clear,           //!< Render target clearing
+        Render,          //!< Scene and gui rendering
+        Display,         //!< Render target display (buffer swap, frame rate limiting)
+        PostFrameUpdate, //!< Scene transitions and cleanup at the end of the frame
+        Count            //!< Keep last, the number of phases
+    };
+
+    /**
+     * @brief Timing statistics of a frame phase
+     */
+    struct IME_API PhaseStats {
+        Time min;     //!< The shortest recorded time
+        Time max;     //!< The longest recorded time
+        Time average; //!< The average recorded time
+        Time p95;     //!< The 95th percentile of the recorded times
+        Time p99;     //!< The 99th percentile of the recorded times
+    };
+
+    /**
+     * @brief Timing statistics of the last N frames
+     */
+    struct IME_API FrameStats {
+        std::size_t frameCount = 0;                                         //!< The number of frames the statistics were computed from
+        PhaseStats frame;                                                   //!< Statistics of the whole frame
+        std::array<PhaseStats, static_cast<std::size_t>(FramePhase::Count)> phases; //!< Statistics of each frame phase (index using ime::FramePhase)
+        float averageFixedUpdates = 0.0f;                                   //!< The average number of fixed updates per frame
+        unsigned int maxFixedUpdates = 0;                                   //!< The highest number of fixed updates in a single frame
+
+        /**
+         * @brief Get the statistics of a frame phase
+         * @param phase The phase to get the statistics of
+         * @return The statistics of the given phase
+         */
+        const PhaseStats& getPhase(FramePhase phase) const;
+    };
+
+    /**
+     * @brief Records the duration of each phase of the last N engine frames
+     *
+     * This class is not meant to be instantiated directly, use
+     * ime::Engine::getFrameProfiler
+     */
+    class IME_API FrameProfiler {
+    public:
+        /**
+         * @brief Timings of a single frame
+         */
+        struct FrameRecord {
+            Time frameTime;                                                      //!< The duration of the whole frame
+            std::array<Time, static_cast<std::size_t>(FramePhase::Count)> phases; //!< The duration of each phase
+            unsigned int fixedUpdates = 0;                                       //!< The number of fixed updates performed in the frame
+        };
+
+        /**
+         * @brief Constructor
+         * @param capacity The number of frames to keep records of
+         */
+        explicit FrameProfiler(std::size_t capacity = 300);
+
+        /**
+         * @brief Enable or disable the profiler
+         * @param enable True to enable or false to disable
+         *
+         * When disabled, the profiler does not record anything
+         *
+         * By default, the profiler is enabled
+         *
+         * @see isEnabled
+         */
+        void setEnabled(bool enable);
+
+        /**
+         * @brief Check if the profiler is enabled or not
+         * @return True if enabled, otherwise false
+         *
+         * @see setEnabled
+         */
+        bool isEnabled() const;
+
+        /**
+         * @brief Set the number of frames to keep records of
+         * @param capacity The number of frames to keep records of
+         *
+         * Records that do not fit the new capacity are discarded. By
+         * default, the profiler keeps records of the last 300 frames
+         *
+         * @see getCapacity
+         */
+        void setCapacity(std::size_t capacity);
+
+        /**
+         * @brief Get the number of frames the profiler keeps records of
+         * @return The number of frames the profiler keeps records of
+         */
+        std::size_t getCapacity() const;
+
+        /**
+         * @brief Get the number of frames currently recorded
+         * @return The number of frames currently recorded
+         */
+        std::size_t getRecordCount() const;
+
+        /**
+         * @brief Get the record of the most recent complete frame
+         * @return The record of the most recent frame
+         *
+         * @warning This function must not be called when there are no
+         * records, see getRecordCount()
+         */
+        const FrameRecord& getLastFrame() const;
+
+        /**
+         * @brief Compute the statistics of the recorded frames
+         * @return The statistics of the recorded frames
+         *
+         * Note that this function sorts copies of the records, it is
+         * intended for diagnostics and should not be called every frame
+         */
+        FrameStats computeStats() const;
+
+        /**
+         * @brief Discard all recorded frames
+         */
+        void clear();
+
+        /**
+         * @internal
+         * @brief Start recording a new frame
+         *
+         * @warning This function is called internally by IME, do not
+         * call it directly
+         */
+        void beginFrame();
+
+        /**
+         * @internal
+         * @brief End a frame phase
+         * @param phase The phase that ended
+         *
+         * The duration of the phase is the time passed since the previous
+         * phase ended, or since the frame started if this is the first
+         * phase of the frame
+         *
+         * @warning This function is called internally by IME, do not
+         * call it directly
+         */
+        void endPhase(FramePhase phase);
+
+        /**
+         * @internal
+         * @brief Add time that was measured elsewhere to a frame phase
+         * @param phase The phase to add the time to
+         * @param time The time to be added
+         *
+         * This function is used for phases that do not run on the thread
+         * that records the frame. Unlike endPhase(), it does not affect
+         * the duration of the next phase
+         *
+         * @warning This function is called internally by IME, do not
+         * call it directly
+         */
+        void addPhaseTime(FramePhase phase, Time time);
+
+        /**
+         * @internal
+         * @brief Stop counting time towards the current phase
+         *
+         * The time between a call to this function and the next call to
+         * resume() is excluded from the current phase. It is still part
+         * of the frame time
+         *
+         * @warning This function is called internally by IME, do not
+         * call it directly
+         *
+         * @see resume
+         */
+        void pause();
+
+        /**
+         * @internal
+         * @brief Resume counting time towards the current phase
+         *
+         * @warning This function is called internally by IME, do not
+         * call it directly
+         *
+         * @see pause
+         */
+        void resume();
+
+        /**
+         * @internal
+         * @brief Set the number of fixed updates performed in the current frame
+         * @param count The number of fixed updates
+         *
+         * @warning This function is called internally by IME, do not
+         * call it directly
+         */
+        void setFixedUpdateCount(unsigned int count);
+
+        /**
+         * @internal
+         * @brief Finish recording the current frame
+         *
+         * @warning This function is called internally by IME, do not
+         * call it directly
+         */
+        void endFrame();
+
+    private:
+        using TimePoint = std::chrono::steady_clock::time_point; //!< Alias
+
+        std::vector<FrameRecord> records_; //!< Ring buffer of frame records
+        std::size_t capacity_;             //!< The maximum number of records
+        std::size_t next_;                 //!< The index of the next record to be overwritten
+        FrameRecord current_;              //!< The record of the frame currently in progress
+        TimePoint frameStart_;             //!< The time the current frame started
+        TimePoint lastMark_;               //!< The time the last phase ended
+        TimePoint pauseStart_;             //!< The time the profiler was last paused
+        bool isEnabled_;                   //!< A flag indicating whether or not the profiler is enabled
+    };
+}
+
+/**
+ * @class ime::FrameProfiler
+ * @ingroup core
+ *
+ * The engine records the duration of each phase of its main loop along
+ * with the number of fixed updates it performed in a frame. Only the last
+ * N frames are kept, so the profiler can stay on at all times. When a hitch
+ * occurs, the statistics show which phase caused it:
+ *
+ * @code
+ * ime::FrameStats stats = engine.getFrameStats();
+ * std::cout << "Render p99: " << stats.getPhase(ime::FramePhase::Render).p99.asMilliseconds() << "ms\n";
+ * std::cout << "Max physics catch-up steps: " << stats.maxFixedUpdates << "\n";
+ * @endcode
+ */
+
+#endif //IME_FRAMEPROFILER_H
@@ -0,0 +1,268 @@
+////////////////////////////////////////////////////////////////////////////////
+// IME - Infinite Motion Engine
+//
+// Copyright (c) 2020-2022 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef IME_JOBSYSTEM_H
+#define IME_JOBSYSTEM_H
+
+#include "IME/Config.h"
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+namespace ime {
+
+    /// @internal
+    namespace priv {
+        struct JobState;
+    }
+
+    /**
+     * @brief A handle to a job scheduled on an ime::JobSystem
+     */
+    class IME_API JobHandle {
+    public:
+        /**
+         * @brief Default constructor
+         *
+         * Constructs a handle that does not refer to any job
+         */
+        JobHandle() = default;
+
+        /**
+         * @brief Check if the handle refers to a job
+         * @return True if the handle refers to a job, otherwise false
+         */
+        bool isValid() const;
+
+        /**
+         * @brief Check if the job and all its children have completed
+         * @return True if the job is complete or the handle does not refer
+         *         to a job, otherwise false
+         */
+        bool isComplete() const;
+
+    private:
+        /**
+         * @brief Constructor
+         * @param state The state of the job the handle refers to
+         */
+        explicit JobHandle(std::shared_ptr<priv::JobState> state);
+
+    private:
+        std::shared_ptr<priv::JobState> state_; //!< The job the handle refers to
+        friend class JobSystem;
+    };
+
+    /**
+     * @brief Executes jobs on a pool of worker threads
+     */
+    class IME_API JobSystem {
+    public:
+        using Job = std::function<void()>; //!< A unit of work
+
+        /**
+         * @brief Constructor
+         * @param threadCount The number of worker threads
+         *
+         * When @a threadCount is zero, the job system shares its worker
+         * threads with the other job systems that were constructed with a
+         * zero thread count. The shared pool has one worker thread for each
+         * hardware thread except the calling thread (at least one worker
+         * thread is always created). Otherwise, the job system gets its own
+         * @a threadCount worker threads. The threads are only started when
+         * the first job is run
+         */
+        explicit JobSystem(unsigned int threadCount = 0);
+
+        /**
+         * @brief Copy constructor
+         */
+        JobSystem(const JobSystem&) = delete;
+
+        /**
+         * @brief Copy assignment operator
+         */
+        JobSystem& operator=(const JobSystem&) = delete;
+
+        /**
+         * @brief Get the number of worker threads
+         * @return The number of worker threads
+         */
+        unsigned int getThreadCount() const;
+
+        /**
+         * @brief Create a job without running it
+         * @param job The function to be executed by the job
+         * @return A handle to the created job
+         *
+         * Creating a job separately from running it allows child jobs to
+         * be attached to it before it starts executing
+         *
+         * @see createChildJob, run and schedule
+         */
+        JobHandle createJob(Job job);
+
+        /**
+         * @brief Create a job that must complete before its parent does
+         * @param parent The job the created job belongs to
+         * @param job The function to be executed by the job
+         * @return A handle to the created job
+         *
+         * A parent job is only complete once its own function and the
+         * functions of all its children have been executed. The parent
+         * must not be complete when a child is attached to it, therefore
+         * children are either attached before the parent is run or from
+         * within the parent job itself
+         *
+         * @see createJob and run
+         */
+        JobHandle createChildJob(const JobHandle& parent, Job job);
+
+        /**
+         * @brief Run a created job
+         * @param handle The job to be run
+         *
+         * A job can only be run once
+         *
+         * @see createJob and createChildJob
+         */
+        void run(const JobHandle& handle);
+
+        /**
+         * @brief Create and run a job
+         * @param job The function to be executed by the job
+         * @return A handle to the scheduled job
+         *
+         * The returned handle may be ignored if the caller is not
+         * interested in the completion of the job
+         */
+        JobHandle schedule(Job job);
+
+        /**
+         * @brief Block until a job and all its children have completed
+         * @param handle The job to wait for
+         * @throws Any exception thrown by the job or one of its children
+         *
+         * While waiting, the calling thread executes pending jobs instead
+         * of sitting idle. It sleeps when there are no pending jobs
+         */
+        void wait(const JobHandle& handle);
+
+        /**
+         * @brief Block until all the jobs that were run have completed
+         *
+         * Only the jobs run by this job system are waited for, even if its
+         * worker threads are shared with other job systems
+         */
+        void waitForAll();
+
+        /**
+         * @brief Execute a function for each index in a range in parallel
+         * @param begin The first index of the range
+         * @param end One past the last index of the range
+         * @param function The function to be executed for each index
+         * @param grainSize The number of indices executed by a single job
+         * @throws Any exception thrown by @a function
+         *
+         * The range is split into jobs of @a grainSize indices which are
+         * distributed among the worker threads. When @a grainSize is zero,
+         * it is chosen such that each worker thread gets a few jobs. This
+         * function blocks until @a function has been executed for every
+         * index in the range
+         */
+        void parallelFor(std::size_t begin, std::size_t end,
+            const std::function<void(std::size_t)>& function, std::size_t grainSize = 0);
+
+        /**
+         * @brief Execute a function on the main thread
+         * @param job The function to be executed
+         *
+         * This function is typically called at the end of a job to hand its
+         * results over to code that is not thread safe, such as the scene.
+         * The functions are executed by executeMainThreadJobs() in the order
+         * in which they were added
+         */
+        void runOnMainThread(Job job);
+
+        /**
+         * @brief Execute the functions added by runOnMainThread()
+         * @return The number of executed functions
+         *
+         * Functions added while this function is executing are executed by
+         * the next call
+         *
+         * @note The engine calls this function at the end of every frame
+         */
+        std::size_t executeMainThreadJobs();
+
+        /**
+         * @brief Destructor
+         *
+         * Waits for all pending jobs to complete. The worker threads are
+         * stopped when the last job system that uses them is destroyed
+         */
+        ~JobSystem();
+
+    private:
+        class JobSystemImpl;
+        std::unique_ptr<JobSystemImpl> pimpl_;
+    };
+}
+
+/**
+ * @class ime::JobSystem
+ * @ingroup core
+ *
+ * ime::JobSystem distributes work among a pool of worker threads. Each
+ * worker thread has its own queue of jobs. A worker takes jobs from its own
+ * queue first and steals jobs from the queues of other workers when its own
+ * queue is empty, such that no worker sits idle while there is work to do.
+ *
+ * The engine owns a job system which is accessible through
+ * ime::Engine::getJobSystem and ime::Scene::getJobSystem. The job systems
+ * of concurrently running engines share their worker threads. Since the scene
+ * is not thread safe, jobs should only read the scene and hand their results
+ * back to it using runOnMainThread().
+ *
+ * Usage example:
+ * @code
+ * // Find paths for all enemies without blocking the game
+ * ime::JobSystem& jobs = getJobSystem();
+ *
+ * jobs.schedule([&jobs, enemies = getEnemies()] {
+ *      std::vector<Path> paths(enemies.size());
+ *
+ *      jobs.parallelFor(0, enemies.size(), [&](std::size_t i) {
+ *          paths[i] = findPath(enemies[i]);
+ *      });
+ *
+ *      jobs.runOnMainThread([enemies, paths = std::move(paths)] {
+ *          for (std::size_t i = 0; i < enemies.size(); ++i)
+ *              enemies[i]->setPath(paths[i]);
+ *      });
+ * });
+ * @endcode
+ */
+
+#endif // IME_JOBSYSTEM_H
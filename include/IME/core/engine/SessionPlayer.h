@@ -0,0 +1,125 @@
+////////////////////////////////////////////////////////////////////////////////
+// IME - Infinite Motion Engine
+//
+// Copyright (c) 2020-2022 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef IME_SESSIONPLAYER_H
+#define IME_SESSIONPLAYER_H
+
+#include "IME/Config.h"
+#include "IME/core/event/EventBatch.h"
+#include "IME/core/time/Time.h"
+#include <fstream>
+#include <string>
+
+namespace ime {
+    /**
+     * @brief Plays back a session recorded by an ime::SessionRecorder
+     *
+     * The player reads a recording one frame at a time, yielding the
+     * delta time and the system events of each frame in the order they
+     * were recorded
+     *
+     * @see ime::SessionRecorder and the @a REPLAY_FILE engine preference
+     */
+    class IME_API SessionPlayer {
+    public:
+        /**
+         * @brief Default constructor
+         */
+        SessionPlayer();
+
+        /**
+         * @brief Copy constructor
+         */
+        SessionPlayer(const SessionPlayer&) = delete;
+
+        /**
+         * @brief Copy assignment operator
+         */
+        SessionPlayer& operator=(const SessionPlayer&) = delete;
+
+        /**
+         * @brief Open a recording
+         * @param filename The name of the file that contains the recording
+         * @throws FileNotFoundException If @a filename cannot be opened
+         * @throws InvalidParseException If @a filename is not a recording
+         *         or was recorded by an incompatible version of IME
+         *
+         * If a recording is already open, it is closed first
+         */
+        void open(const std::string& filename);
+
+        /**
+         * @brief Read the next frame of the recording
+         * @param deltaTime Receives the time the frame advanced the game by
+         * @param events Receives the system events dispatched in the frame
+         * @return True if a frame was read, or false if there are no more
+         *         frames in the recording
+         *
+         * The previous content of @a events is cleared. A truncated
+         * frame at the end of a recording (e.g. when the recording game
+         * crashed) is treated as the end of the recording
+         */
+        bool readFrame(Time& deltaTime, EventBatch& events);
+
+        /**
+         * @brief Close the recording
+         */
+        void close();
+
+        /**
+         * @brief Check if a recording is open or not
+         * @return True if a recording is open, otherwise false
+         */
+        bool isOpen() const;
+
+        /**
+         * @brief Get the number of frames read so far
+         * @return The number of frames read from the current recording
+         */
+        unsigned int getFrameCount() const;
+
+    private:
+        std::ifstream file_;      //!< The file the recording is read from
+        unsigned int frameCount_; //!< The number of frames read from the current recording
+    };
+}
+
+#endif // IME_SESSIONPLAYER_H
+
+/**
+ * @class ime::SessionPlayer
+ * @ingroup core
+ *
+ * Usage example:
+ * @code
+ * ime::SessionPlayer player;
+ * player.open("session.imes");
+ *
+ * ime::Time deltaTime;
+ * ime::EventBatch events;
+ * while (player.readFrame(deltaTime, events)) {
+ *     // Advance the game by deltaTime and dispatch the events
+ * }
+ * @endcode
+ */
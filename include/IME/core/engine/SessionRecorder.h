@@ -0,0 +1,140 @@
+////////////////////////////////////////////////////////////////////////////////
+// IME - Infinite Motion Engine
+//
+// Copyright (c) 2020-2022 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef IME_SESSIONRECORDER_H
+#define IME_SESSIONRECORDER_H
+
+#include "IME/Config.h"
+#include "IME/core/event/EventBatch.h"
+#include "IME/core/time/Time.h"
+#include <fstream>
+#include <string>
+
+namespace ime {
+    /**
+     * @brief Records the frame delta times and system events of a session
+     *
+     * A recording captures, for every frame, the time the frame advanced
+     * the game by and the system events that were dispatched in it. Since
+     * these are the only inputs of a game loop that are not under the
+     * control of the game, a recording can be played back with an
+     * ime::SessionPlayer to reproduce the session exactly. This is useful
+     * for reproducing bugs and for comparing the performance of two builds
+     * of a game under the same workload
+     *
+     * The recording is stored in a compact binary format. Events are
+     * stored after the engine has processed them, for example, a resize
+     * event is stored with the size the window was actually resized to
+     *
+     * @see ime::Engine::startRecording and ime::SessionPlayer
+     */
+    class IME_API SessionRecorder {
+    public:
+        /**
+         * @brief Default constructor
+         */
+        SessionRecorder();
+
+        /**
+         * @brief Copy constructor
+         */
+        SessionRecorder(const SessionRecorder&) = delete;
+
+        /**
+         * @brief Copy assignment operator
+         */
+        SessionRecorder& operator=(const SessionRecorder&) = delete;
+
+        /**
+         * @brief Start recording a session
+         * @param filename The name of the file to record the session to
+         * @throws FileNotFoundException If @a filename cannot be opened for writing
+         *
+         * If the file already exists, it is overwritten. If a session is
+         * already being recorded, it is stopped first
+         *
+         * @see stop
+         */
+        void start(const std::string& filename);
+
+        /**
+         * @brief Record a single frame
+         * @param deltaTime The time the frame advanced the game by
+         * @param events The system events dispatched in the frame
+         *
+         * This function has no effect if a session is not being recorded
+         */
+        void recordFrame(Time deltaTime, const EventBatch& events);
+
+        /**
+         * @brief Stop recording the current session
+         *
+         * This function flushes the recording to disk and closes the file
+         *
+         * @see start
+         */
+        void stop();
+
+        /**
+         * @brief Check if a session is being recorded or not
+         * @return True if a session is being recorded, otherwise false
+         */
+        bool isRecording() const;
+
+        /**
+         * @brief Get the number of frames recorded in the current session
+         * @return The number of frames recorded in the current session
+         */
+        unsigned int getFrameCount() const;
+
+        /**
+         * @brief Destructor
+         *
+         * Stops the current recording, if any
+         */
+        ~SessionRecorder();
+
+    private:
+        std::ofstream file_;      //!< The file the session is recorded to
+        unsigned int frameCount_; //!< The number of frames recorded in the current session
+    };
+}
+
+#endif // IME_SESSIONRECORDER_H
+
+/**
+ * @class ime::SessionRecorder
+ * @ingroup core
+ *
+ * Usage example:
+ * @code
+ * ime::SessionRecorder recorder;
+ * recorder.start("session.imes");
+ *
+ * // For every frame
+ * recorder.recordFrame(deltaTime, events);
+ *
+ * recorder.stop();
+ * @endcode
+ */
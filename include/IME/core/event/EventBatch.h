@@ -0,0 +1,109 @@
+////////////////////////////////////////////////////////////////////////////////
+// IME - Infinite Motion Engine
+//
+// Copyright (c) 2020-2022 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef IME_EVENTBATCH_H
+#define IME_EVENTBATCH_H
+
+#include "IME/Config.h"
+#include "IME/core/event/Event.h"
+#include "IME/core/event/EventMask.h"
+#include <vector>
+
+namespace ime {
+    /**
+     * @brief The system events polled in a single frame
+     *
+     * The engine polls all pending system events into a batch before
+     * dispatching any of them. This allows redundant events to be removed
+     * (see coalesce()) and allows a subsystem to be skipped entirely when
+     * the batch contains no event it is interested in (see getTypes())
+     */
+    class IME_API EventBatch {
+    public:
+        using ConstIterator = std::vector<Event>::const_iterator; //!< Event iterator
+
+        /**
+         * @brief Add an event to the end of the batch
+         * @param event The event to be added
+         */
+        void push(const Event& event);
+
+        /**
+         * @brief Merge runs of consecutive motion events
+         *
+         * A run of consecutive MouseMoved events is replaced by its last
+         * event. Similarly, a run of consecutive JoystickMoved events of the
+         * same joystick and axis is replaced by its last event. Events of
+         * other types are never removed, therefore the relative order of
+         * all remaining events is preserved
+         *
+         * @return The number of removed events
+         */
+        std::size_t coalesce();
+
+        /**
+         * @brief Get the types of the events in the batch
+         * @return A mask of the event types in the batch
+         */
+        EventMask getTypes() const;
+
+        /**
+         * @brief Get the number of events in the batch
+         * @return The number of events in the batch
+         */
+        std::size_t getCount() const;
+
+        /**
+         * @brief Check if the batch is empty
+         * @return True if the batch has no events, otherwise false
+         */
+        bool isEmpty() const;
+
+        /**
+         * @brief Remove all events from the batch
+         *
+         * The memory used by the events is retained such that the batch
+         * can be reused by the next frame without reallocating
+         */
+        void clear();
+
+        /**
+         * @brief Get an iterator to the first event in the batch
+         * @return An iterator to the first event in the batch
+         */
+        ConstIterator begin() const;
+
+        /**
+         * @brief Get an iterator past the last event in the batch
+         * @return An iterator past the last event in the batch
+         */
+        ConstIterator end() const;
+
+    private:
+        std::vector<Event> events_; //!< Events in the order they were polled
+        EventMask types_;           //!< The types of the events in the batch
+    };
+}
+
+#endif // IME_EVENTBATCH_H
@@ -27,13 +27,26 @@
 
 #include "IME/Config.h"
 #include "EventEmitter.h"
+#include <atomic>
+#include <functional>
 #include <memory>
 #include <string>
+#include <tuple>
 
 namespace ime {
+    /// @internal
+    namespace priv {
+        class EventQueue;
+        struct QueuedEvent;
+    }
+
     /**
      * @brief A singleton class that creates a communication interface between
      *        separate parts of a program through event dispatching
+     *
+     * The dispatcher is shared by every engine in the process and may be
+     * used from multiple threads, access to the underlying emitter is
+     * synchronized
      */
     class IME_API EventDispatcher {
     public:
@@ -69,6 +82,76 @@ namespace ime {
         template<typename... Args>
         void dispatchEvent(const std::string& event, Args&& ...args);
 
+        /**
+         * @brief Queue an event for deferred dispatch
+         * @param event Name of the event to queue
+         * @param args Arguments to be passed to event listeners
+         *
+         * Unlike dispatchEvent(), this function does not invoke the event
+         * listeners. It copies the arguments and adds the event to a queue
+         * that is dispatched by dispatchQueuedEvents(). Posting never blocks,
+         * therefore it is safe and cheap to call from any thread, such as a
+         * job of the ime::JobSystem that wants to notify game code
+         *
+         * An event posted by a thread that belongs to an engine (the thread
+         * running the engine, its simulation thread or a job created by one
+         * of them) is only dispatched by that engine, so its listeners run
+         * on the thread of that engine. Events posted by other threads are
+         * dispatched by the engine that was started first
+         *
+         * @see postCoalesced, dispatchQueuedEvents
+         */
+        template<typename... Args>
+        void post(const std::string& event, Args&& ...args);
+
+        /**
+         * @brief Queue an event that replaces a queued event with the same name
+         * @param event Name of the event to queue
+         * @param args Arguments to be passed to event listeners
+         *
+         * If an event with the same name that was also posted with this
+         * function is still waiting to be dispatched, its arguments are
+         * replaced by @a args instead of the event being queued a second
+         * time. This is useful for events where only the latest state is
+         * of interest, such as progress updates
+         *
+         * @see post
+         */
+        template<typename... Args>
+        void postCoalesced(const std::string& event, Args&& ...args);
+
+        /**
+         * @brief Dispatch the events queued by post() and postCoalesced()
+         * @return The number of dispatched events
+         *
+         * Events are dispatched in the order in which they were posted, on
+         * the thread that calls this function. When it is called by the
+         * thread of an engine, only the events posted for that engine are
+         * dispatched (see post()). At most getQueuedEventBudget() events are
+         * dispatched, the rest remain queued for the next call. If another
+         * thread is already dispatching the same queue, this function returns
+         * immediately
+         *
+         * @note The engine calls this function at the end of every frame
+         */
+        std::size_t dispatchQueuedEvents();
+
+        /**
+         * @brief Set the maximum number of queued events that are dispatched
+         *        by a single call to dispatchQueuedEvents()
+         * @param budget The maximum number of dispatched events, 0 for no limit
+         *
+         * By default, there is no limit
+         */
+        void setQueuedEventBudget(std::size_t budget);
+
+        /**
+         * @brief Get the maximum number of queued events that are dispatched
+         *        by a single call to dispatchQueuedEvents()
+         * @return The maximum number of dispatched events, 0 if there is no limit
+         */
+        std::size_t getQueuedEventBudget() const;
+
         /**
          * @brief Remove an event listener from an event
          * @param event Event to remove event listener from
@@ -79,22 +162,65 @@ namespace ime {
          */
         bool removeEventListener(const std::string& event, int id);
 
+        /**
+         * @internal
+         * @brief Route the events posted by the calling thread to a queue
+         * @param queue The queue of the engine that runs on the calling thread
+         *
+         * The first queue that is bound also receives the events posted
+         * by threads that do not belong to an engine
+         *
+         * @warning This function is intended for internal use only and
+         * should never be called outside of IME
+         */
+        void bindQueue(priv::EventQueue& queue);
+
+        /**
+         * @internal
+         * @brief Stop routing the events posted by the calling thread to a queue
+         * @param queue The queue that was bound with bindQueue()
+         *
+         * @warning This function is intended for internal use only and
+         * should never be called outside of IME
+         */
+        void unbindQueue(priv::EventQueue& queue);
+
         /**
          * @brief Get class instance
          * @return Shared pointer to class instance
          */
         static EventDispatcher::Ptr instance();
 
+        /**
+         * @brief Destructor
+         *
+         * Queued events that were not dispatched are discarded
+         */
+        ~EventDispatcher();
+
     private:
         /**
          * @brief Default constructor
          */
-        EventDispatcher() = default;
+        EventDispatcher();
+
+        /**
+         * @brief Add an event to the queue
+         * @param event Name of the event
+         * @param emit Function that emits the event with its arguments
+         * @param isCoalesced True if the event replaces a queued event with
+         *                    the same name, otherwise false
+         */
+        void enqueue(const std::string& event, std::function<void(EventEmitter&, const std::string&)> emit,
+            bool isCoalesced);
 
     private:
-        EventDispatcher::Ptr instance_;  //!< The only class instance
-        EventEmitter eventEmitter_;      //!< Event publisher
-        inline static std::mutex mutex_; //!< Synchronization primitive
+        EventDispatcher::Ptr instance_;                     //!< The only class instance
+        EventEmitter eventEmitter_;                         //!< Event publisher
+        std::unique_ptr<priv::EventQueue> queue_;           //!< Events posted by threads that do not belong to an engine
+        std::atomic<priv::EventQueue*> unboundEventsQueue_; //!< The engine queue that also dispatches the events of queue_
+        std::atomic<std::size_t> queueBudget_;              //!< Maximum number of queued events dispatched at a time
+        inline static std::mutex mutex_;                    //!< Synchronization primitive
     };
 
     #include "IME/core/event/EventDispatcher.inl"
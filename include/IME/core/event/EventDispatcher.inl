@@ -31,3 +31,17 @@ template<typename... Args>
 int EventDispatcher::onEvent(const std::string &event, Callback<Args...> callback) {
     return eventEmitter_.addEventListener(event, std::move(callback));
 }
+
+template<typename... Args>
+void EventDispatcher::post(const std::string &event, Args &&... args) {
+    enqueue(event, [arguments = std::make_tuple(std::forward<Args>(args)...)](EventEmitter& emitter, const std::string& name) {
+        std::apply([&emitter, &name](const auto&... values) { emitter.emit(name, values...); }, arguments);
+    }, false);
+}
+
+template<typename... Args>
+void EventDispatcher::postCoalesced(const std::string &event, Args &&... args) {
+    enqueue(event, [arguments = std::make_tuple(std::forward<Args>(args)...)](EventEmitter& emitter, const std::string& name) {
+        std::apply([&emitter, &name](const auto&... values) { emitter.emit(name, values...); }, arguments);
+    }, true);
+}
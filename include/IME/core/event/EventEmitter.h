@@ -26,12 +26,18 @@
 #define IME_EVENTEMITTER_H
 
 #include "IME/Config.h"
+#include "IME/core/event/EventKey.h"
+#include "IME/core/event/EventStats.h"
 #include <unordered_map>
 #include <string>
 #include <memory>
+#include <new>
 #include <vector>
 #include <functional>
 #include <mutex>
+#include <atomic>
+#include <type_traits>
+#include <typeinfo>
 
 namespace ime {
     template <typename... Args>
@@ -42,18 +48,46 @@ namespace ime {
      */
     class IME_API EventEmitter {
     public:
+        /**
+         * @brief Determines whether or not an emitter synchronizes access
+         */
+        enum class ThreadingPolicy {
+            SingleThreaded, //!< Not synchronized, the emitter must only be accessed by one thread at a time
+            MultiThreaded   //!< Synchronized, the emitter may be accessed by multiple threads
+        };
+
         /**
          * @brief Default constructor
+         *
+         * The emitter is constructed with the ThreadingPolicy::MultiThreaded
+         * policy
          */
         EventEmitter();
 
+        /**
+         * @brief Construct the emitter with a threading policy
+         * @param policy The threading policy of the emitter
+         *
+         * A ThreadingPolicy::SingleThreaded emitter does not lock when
+         * listeners are added, removed or notified. It is cheaper to use
+         * but undefined behavior occurs if it is accessed by more than one
+         * thread at the same time
+         */
+        explicit EventEmitter(ThreadingPolicy policy);
+
         /**
          * @brief Copy constructor
+         *
+         * If the emitter being copied is emitting an event, the copy gets
+         * the listeners the emitter will have when the emission ends
          */
         EventEmitter(const EventEmitter&);
 
         /**
          * @brief Copy assignment operator
+         *
+         * @warning The emitter must not be assigned to while it is
+         * emitting an event (e.g from one of its listeners)
          */
         EventEmitter& operator=(const EventEmitter&);
 
@@ -64,9 +98,17 @@ namespace ime {
 
         /**
          * @brief Move assignment operator
+         *
+         * @warning The emitter must not be assigned to while it is
+         * emitting an event (e.g from one of its listeners)
          */
         EventEmitter& operator=(EventEmitter&&) noexcept;
 
+        /**
+         * @brief Destructor
+         */
+        ~EventEmitter();
+
         /**
          * @brief Add an event listener (callback) to an event
          * @param event Event to add event listener to
@@ -81,7 +123,7 @@ namespace ime {
          * identification number
          */
         template<typename...Args>
-        int addEventListener(const std::string &event, Callback<Args...> callback);
+        int addEventListener(const EventKey& event, Callback<Args...> callback);
 
         /**
          * @brief Add an event listener to an event
@@ -98,7 +140,7 @@ namespace ime {
          *  @endcode
          */
         template<typename...Args>
-        int on(const std::string &event, Callback<Args...> callback);
+        int on(const EventKey& event, Callback<Args...> callback);
 
         /**
          * @brief Add an event listener to an event
@@ -114,7 +156,7 @@ namespace ime {
          * @see addEventListener
          */
          template <typename ...Args>
-        int addOnceEventListener(const std::string &event, Callback<Args...> callback);
+        int addOnceEventListener(const EventKey& event, Callback<Args...> callback);
 
         /**
          * @brief Remove an event listener from an event
@@ -126,7 +168,7 @@ namespace ime {
          *
          * @see clear, removeEventListener(int);
          */
-         bool removeEventListener(const std::string &event, int id);
+         bool removeEventListener(const EventKey& event, int id);
 
          /**
           * @brief Remove an event listener from an event
@@ -135,10 +177,10 @@ namespace ime {
           *         event listener exists
           *
           * This function searches for the event listener in all events.
-          * Therefore it may be slower than removeEventListener(const std::string&, int)
+          * Therefore it may be slower than removeEventListener(const EventKey&, int)
           * which searches in a specific event
           *
-          * @see removeEventListener(const std::string&, int)
+          * @see removeEventListener(const EventKey&, int)
           */
          bool removeEventListener(int id);
 
@@ -150,11 +192,15 @@ namespace ime {
           *
           * @see clear
           */
-         bool removeAllEventListeners(const std::string &event);
+         bool removeAllEventListeners(const EventKey& event);
 
          /**
           * @brief Remove all events and event listeners
           *
+          * If this function is called by an event listener, the listeners
+          * are removed but the events remain registered until the emitter
+          * is cleared outside of an emission
+          *
           * @see removeAllEventListeners, removeAllEventListener
           */
          void clear();
@@ -163,9 +209,25 @@ namespace ime {
          * @brief Fire an event
          * @param event Name of the event to fire
          * @param args Arguments to be passed to event listeners
+         *
+         * Only the listeners whose callback takes arguments of exactly the
+         * same types as @a args are notified. Arguments are passed by
+         * reference to listeners that take references. To notify a listener
+         * of type Callback<int&>, the template argument must be explicitly
+         * specified:
+         *
+         * @code
+         * int value = 10;
+         * emitter.emit<int&>("event", value);
+         * @endcode
+         *
+         * Event listeners may add and remove event listeners while they are
+         * being notified. A listener that is removed during the emission is
+         * not notified if it has not been notified yet. A listener that is
+         * added during the emission is first notified by the next emission
          */
         template<typename...Args>
-        void emit(const std::string &event, Args...args);
+        void emit(const EventKey& event, const Args&...args);
 
         /**
          * @brief Suspend the execution of an event listener
@@ -182,7 +244,7 @@ namespace ime {
          *
          * @see isEventListenerSuspended, suspendEventListener(int, bool)
          */
-        bool suspendEventListener(const std::string& event, int id, bool suspend);
+        bool suspendEventListener(const EventKey& event, int id, bool suspend);
 
         /**
          * @brief Suspend the execution of an event listener
@@ -195,11 +257,11 @@ namespace ime {
          * when the event its listening for is emitted/fired.
          *
          * Note that this function will search for the event listener in all
-         * events. Therefore it may be slower than suspendEventListener(const std::string&, int, bool)
+         * events. Therefore it may be slower than suspendEventListener(const EventKey&, int, bool)
          *
          * By default an event listener is not suspended
          *
-         * @see isEventListenerSuspended, suspendEventListener(const std::string&, int, bool)
+         * @see isEventListenerSuspended, suspendEventListener(const EventKey&, int, bool)
          */
         bool suspendEventListener(int id, bool suspend);
 
@@ -212,9 +274,9 @@ namespace ime {
          * This function also returns false if the specified event or event
          * listener do not exist
          *
-         * @see suspendEventListener(const std::string&, int, bool) and suspendEventListener(int, bool)
+         * @see suspendEventListener(const EventKey&, int, bool) and suspendEventListener(int, bool)
          */
-        bool isEventListenerSuspended(const std::string& event, int id) const;
+        bool isEventListenerSuspended(const EventKey& event, int id) const;
 
         /**
          * @brief Check if an event listener is suspended or not
@@ -223,9 +285,9 @@ namespace ime {
          *
          * This function also returns false if event listener does not exist.
          * In addition, the function searches for the event listener in all
-         * events. Therefore it may be slower than suspendEventListener(const std::string&, int, bool)
+         * events. Therefore it may be slower than suspendEventListener(const EventKey&, int, bool)
          *
-         * @see isEventListenerSuspended(const std::string&, int)
+         * @see isEventListenerSuspended(const EventKey&, int)
          */
         bool isEventListenerSuspended(int id) const;
 
@@ -234,7 +296,7 @@ namespace ime {
          * @param event Name of the event to check
          * @return True if event exists or false if the event does not exist
          */
-        bool hasEvent(const std::string& event) const;
+        bool hasEvent(const EventKey& event) const;
 
         /**
          * @brief Get the number of event listeners currently registered to
@@ -243,7 +305,7 @@ namespace ime {
          * @return The number of event listeners registered to an event or 0
          *         if no such event exists
          */
-        std::size_t getEventListenerCount(const std::string& event) const;
+        std::size_t getEventListenerCount(const EventKey& event) const;
 
         /**
          * @brief Get the current number of created events
@@ -258,7 +320,7 @@ namespace ime {
          * @return True if the specified event has an event listener with the
          *         specified id, otherwise false
          */
-        bool hasEventListener(const std::string& event, int id) const;
+        bool hasEventListener(const EventKey& event, int id) const;
 
         /**
          * @brief Get the list of registered events
@@ -287,6 +349,16 @@ namespace ime {
          */
         bool isActive() const;
 
+        /**
+         * @brief Get the threading policy of the emitter
+         * @return The threading policy of the emitter
+         *
+         * The threading policy is set on construction and cannot be
+         * changed afterwards. It is retained when another emitter is
+         * assigned to this emitter
+         */
+        ThreadingPolicy getThreadingPolicy() const;
+
     private:
         /**
          * @brief  Add an event listener (callback) to an event
@@ -297,72 +369,269 @@ namespace ime {
          * @return listener's identification number
          */
         template<typename...Args>
-        int addListener(const std::string &event, Callback<Args...> callback,
+        int addListener(const EventKey& event, Callback<Args...> callback,
             bool isCalledOnce);
 
-         /**
-         * @brief Check if an event has a certain event listener
-         * @param event Name of the event
-         * @param listenerId Identification number of the listener to be checked
-         * @return A pair, of which the first element is a bool that is true if
-         *         the specified event has an event listener with the specified id, 
-                   otherwise false and the second is an int which is the index of
-                   the found event listener in the specified event listeners list
+    private:
+        /**
+         * @brief Get the type of a listener signature
+         * @return The type of the signature void(Args...)
          *
-         * @warning If the first element of the pair is false, the second element
-         * is invalid (Function will return a negative index)
+         * The type is looked up once per signature. Unlike a hash of the
+         * type, it identifies the signature uniquely
          */
-        std::pair<bool, int>  hasListener(const std::string& event, int listenerId) const;
+        template <typename... Args>
+        static const std::type_info* getSignature();
 
-    private:
         /**
-         * @brief Base class for template class
+         * @brief Check if two listener signatures are the same
+         * @param lhs The first signature
+         * @param rhs The second signature
+         * @return True if the signatures are the same, otherwise false
          *
-         * This allows the template instance to be storable in a container
+         * The types are only compared when their addresses differ, which
+         * happens when the signatures are looked up in different modules
          */
-        struct IListener {
-            explicit IListener(int id) :
-                id_(id),
-                isSuspended_(false)
-            {}
+        static bool isSameSignature(const std::type_info* lhs, const std::type_info* rhs) {
+            return lhs == rhs || *lhs == *rhs;
+        }
 
-            virtual ~IListener() = default;
+        /**
+         * @brief The argument type of a listener that is notified with
+         *        an argument of type T
+         *
+         * Arrays, such as string literals, are passed to listeners as
+         * pointers, all other types are passed as they are
+         */
+        template <typename T>
+        using ArgumentType = std::conditional_t<std::is_array_v<T>, std::decay_t<const T>, T>;
 
-            int id_;
-            bool isSuspended_;
+        /**
+         * @brief Event listener
+         *
+         * The callback is stored in place rather than on the heap. The type
+         * of its signature is recorded when the listener is added, such that
+         * emit() can tell whether or not the listener accepts the emitted
+         * arguments with a single comparison in the common case
+         */
+        struct Listener {
+            template <typename... Args>
+            Listener(int id, Callback<Args...> callback, bool isCalledOnce);
+            Listener(const Listener& other);
+            Listener& operator=(const Listener& other);
+            Listener(Listener&& other) noexcept;
+            Listener& operator=(Listener&& other) noexcept;
+            ~Listener();
+
+            /**
+             * @brief Get the callback of the listener
+             * @return The callback of the listener
+             *
+             * @warning The listener must have the signature void(Args...)
+             */
+            template <typename... Args>
+            Callback<Args...>& getCallback();
+
+            /**
+             * @brief Type specific operations on a stored callback
+             */
+            struct Operations {
+                void (*copy)(void* destination, const void* source);
+                void (*move)(void* destination, void* source) noexcept;
+                void (*destroy)(void* callback) noexcept;
+            };
+
+            /**
+             * @brief Get the operations of a callback type
+             * @return The operations of Callback<Args...>
+             */
+            template <typename... Args>
+            static const Operations* getOperations();
+
+            int id_;                          //!< The identification number of the listener
+            bool isSuspended_;                //!< A flag indicating whether or not the listener is suspended
+            bool isCalledOnce_;               //!< A flag indicating whether or not the listener is removed after it is called
+            bool isRemoved_;                  //!< A flag indicating whether or not the listener was removed during an emission
+            const std::type_info* signature_; //!< The type of the signature of the callback
+            const Operations* operations_;    //!< Copies, moves and destroys the callback
+            alignas(Callback<>) unsigned char callback_[sizeof(Callback<>)]; //!< Storage for the callback
         };
 
+        using Listeners = std::vector<Listener>; //!< Alias
+
         /**
-         * @brief Event listener
+         * @brief A listener that was added while an event was emitted
+         */
+        struct PendingListener {
+            Listeners* listeners; //!< The listeners the listener is added to
+            Listener listener;    //!< The added listener
+        };
+
+        /**
+         * @brief An event and its listeners
+         */
+        struct EventEntry {
+            std::string name;    //!< The name of the event
+            Listeners listeners; //!< The listeners of the event
+        };
+
+        /**
+         * @brief The events and listeners of an emitter
+         *
+         * Most emitters never get a listener, so the storage is only
+         * allocated when the first listener is added. Once allocated, it
+         * lives until the emitter is destroyed
          */
-        template <typename ...Args>
-        struct Listener : public IListener {
-            Listener(int id, Callback<Args...> callback, bool isCalledOnce = false) :
-                IListener(id),
-                callback_(callback),
-                isCalledOnce_(isCalledOnce)
-            {}
+        struct Storage {
+            std::unordered_map<Uint64, EventEntry> eventList;   //!< Events container, keyed by the hash of the event name
+            unsigned int emitDepth = 0;                         //!< The number of emissions in progress
+            std::vector<PendingListener> pendingListeners;      //!< Listeners added during an emission
+            std::vector<Listeners*> removedListeners;           //!< Listeners with listeners marked as removed
+            std::unordered_map<int, Listeners*> listenerIndex;  //!< The listeners of the event each listener is subscribed to, by listener id
+            std::recursive_mutex mutex;                         //!< Synchronization primitive
+        };
 
-            Callback<Args...> callback_;
-            bool isCalledOnce_;
+        /**
+         * @brief Defers changes to the listeners while an event is emitted
+         *
+         * While at least one scope exists, listeners that are removed are
+         * only marked as removed and listeners that are added are kept
+         * aside, such that the listeners being iterated by emit() are
+         * neither moved nor destroyed. The changes are applied when the
+         * outermost scope ends
+         */
+        struct EmitScope {
+            explicit EmitScope(Storage& storage) :
+                storage_{storage}
+            {
+                ++storage_.emitDepth;
+            }
+
+            ~EmitScope() {
+                if (--storage_.emitDepth == 0 && (!storage_.pendingListeners.empty() || !storage_.removedListeners.empty()))
+                    applyDeferredChanges(storage_);
+            }
+
+            Storage& storage_;
         };
 
+        /**
+         * @brief Get the storage of the emitter
+         * @return The storage of the emitter or a nullptr if no listener
+         *         was ever added to it
+         */
+        Storage* getStorage() const;
+
+        /**
+         * @brief Get the storage of the emitter, allocating it if it does
+         *        not exist
+         * @return The storage of the emitter
+         */
+        Storage& getOrCreateStorage();
+
         /**
          * @brief Get an event listener
-         * @param event The event the listener is subscribed to
+         * @param storage The storage to search
          * @param id The identification number of the event listener
          * @return A pointer to the event listener if it exists, otherwise a
          *         nullptr
+         *
+         * The listener is looked up in the event it is subscribed to only.
+         * Listeners that were removed during an emission are not returned,
+         * listeners that were added during an emission are
+         */
+        static Listener* findListener(Storage& storage, int id);
+        static const Listener* findListener(const Storage& storage, int id);
+
+        /**
+         * @brief Get an event listener of an event
+         * @param storage The storage the listeners belong to
+         * @param listeners The listeners of the event, may be a nullptr
+         * @param id The identification number of the event listener
+         * @return A pointer to the event listener if it exists, otherwise a
+         *         nullptr
+         */
+        static Listener* findListener(Storage& storage, Listeners* listeners, int id);
+        static const Listener* findListener(const Storage& storage, const Listeners* listeners, int id);
+
+        /**
+         * @brief Remove an event listener from an event
+         * @param storage The storage the listeners belong to
+         * @param listeners The listeners of the event
+         * @param id The identification number of the event listener
+         * @return True if the listener was removed, or false if the event
+         *         does not have a listener with the given id
+         */
+        static bool removeListener(Storage& storage, Listeners& listeners, int id);
+
+        /**
+         * @brief Map the identification number of every listener to the
+         *        listeners of its event
+         * @param storage The storage to be indexed
+         */
+        static void rebuildListenerIndex(Storage& storage);
+
+        /**
+         * @brief Copy the listeners of a storage to another storage
+         * @param source The storage to copy the listeners from
+         * @param destination The storage to copy the listeners to
+         *
+         * Changes that are deferred by an emission in progress on
+         * @a source are applied to the copy: listeners marked as removed
+         * are left out and listeners pending addition are included
+         */
+        static void copyListeners(const Storage& source, Storage& destination);
+
+        /**
+         * @brief Mark a listener as removed
+         * @param storage The storage the listeners belong to
+         * @param listeners The listeners the listener belongs to
+         * @param listener The listener to be marked
+         *
+         * The listener is erased when the outermost emission ends
+         */
+        static void markRemoved(Storage& storage, Listeners& listeners, Listener& listener);
+
+        /**
+         * @brief Erase the listeners that were removed and add the
+         *        listeners that were added during an emission
+         * @param storage The storage to be updated
+         */
+        static void applyDeferredChanges(Storage& storage);
+
+        /**
+         * @brief Get the listeners of an event
+         * @param storage The storage to search
+         * @param event The event to get the listeners of
+         * @return A pointer to the listeners of the event if the event
+         *         exists, otherwise a nullptr
+         */
+        static Listeners* findListeners(Storage& storage, const EventKey& event);
+        static const Listeners* findListeners(const Storage& storage, const EventKey& event);
+
+        /**
+         * @brief Get the listeners of an event, creating the event if it
+         *        does not exist
+         * @param storage The storage to search
+         * @param event The event to get the listeners of
+         * @return The listeners of the event
+         */
+        static Listeners& getOrCreateListeners(Storage& storage, const EventKey& event);
+
+        /**
+         * @brief Lock the emitter if it is synchronized
+         * @param storage The storage of the emitter
+         * @return A lock that owns the mutex of the storage if the policy of
+         *         the emitter is ThreadingPolicy::MultiThreaded, otherwise an
+         *         empty lock
          */
-        IListener* getListener(const std::string& event, int id);
-        const IListener* getListener(const std::string& event, int id) const;
+        std::unique_lock<std::recursive_mutex> lock(Storage& storage) const;
 
         // Data members
-        static unsigned int idCounter_;                            //!< Event listener id counter
-        using Listeners = std::vector<std::shared_ptr<IListener>>; //!< Alias
-        std::unordered_map<std::string, Listeners> eventList_;     //!< Events container
-        bool isActive_;                                            //!< A flag indicating whether or not the emitter is active
-        mutable std::recursive_mutex mutex_;                       //!< Synchronization primitive
+        static std::atomic<unsigned int> idCounter_; //!< Event listener id counter
+        std::atomic<Storage*> storage_;              //!< Events and listeners, allocated on first use
+        bool isActive_;                              //!< A flag indicating whether or not the emitter is active
+        ThreadingPolicy threadingPolicy_;            //!< Whether or not access to the emitter is synchronized
     };
 
     #include "IME/core/event/EventEmitter.inl"
@@ -23,47 +23,120 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 template<typename... Args>
-int EventEmitter::addEventListener(const std::string &event, Callback<Args...> callback) {
+int EventEmitter::addEventListener(const EventKey& event, Callback<Args...> callback) {
     return addListener(event, callback, false);
 }
 
 template<typename... Args>
-int EventEmitter::on(const std::string &event, Callback<Args...> callback) {
+int EventEmitter::on(const EventKey& event, Callback<Args...> callback) {
     return addEventListener(event, callback);
 }
 
 template<typename... Args>
-int EventEmitter::addOnceEventListener(const std::string &event, Callback<Args...> callback) {
+int EventEmitter::addOnceEventListener(const EventKey& event, Callback<Args...> callback) {
     return addListener(event, callback, true);
 }
 
 template<typename...Args>
-int EventEmitter::addListener(const std::string &event, Callback<Args...> callback, bool isCalledOnce) {
+int EventEmitter::addListener(const EventKey& event, Callback<Args...> callback, bool isCalledOnce) {
     IME_ASSERT(callback, "Cannot add nullptr as an event listener");
 
-    std::scoped_lock lock(mutex_);
+    Storage& storage = getOrCreateStorage();
+    auto lock = this->lock(storage);
     auto listenerId = ++idCounter_;
-    auto listener = std::make_shared<Listener<Args...>>(listenerId, callback, isCalledOnce);
-    if (hasEvent(event))
-        eventList_.at(event).push_back(std::move(listener));
+    Listeners& listeners = getOrCreateListeners(storage, event);
+    storage.listenerIndex.emplace(listenerId, &listeners);
+
+    if (storage.emitDepth > 0)
+        storage.pendingListeners.push_back({&listeners, Listener(listenerId, std::move(callback), isCalledOnce)});
     else
-        eventList_.insert({event, std::vector<std::shared_ptr<IListener>>{std::move(listener)}});
+        listeners.emplace_back(listenerId, std::move(callback), isCalledOnce);
 
     return listenerId;
 }
 
 template<typename... Args>
-void EventEmitter::emit(const std::string &event, Args... args) {
-    std::scoped_lock lock(mutex_);
-    if (isActive_ && hasEvent(event)) {
-        auto& listeners = eventList_.at(event);
-        for (auto& listenerBase : listeners) {
-            auto listener = std::dynamic_pointer_cast<Listener<Args...>>(listenerBase);
-            if (listener && listener->callback_ && !listener->isSuspended_) {
-                std::invoke(listener->callback_, args...);
-                if (listener->isCalledOnce_)
-                    removeEventListener(event, listener->id_);
+void EventEmitter::emit(const EventKey& event, const Args&... args) {
+    if (!isActive_)
+        return;
+
+#ifdef IME_ENABLE_EVENT_STATS
+    // Emits are counted even if the event has no listeners
+    priv::EmitRecorder recorder{event};
+#endif
+
+    // Emitters that never had a listener have nothing to notify
+    Storage* storage = getStorage();
+    if (!storage)
+        return;
+
+    auto lock = this->lock(*storage);
+
+    if (Listeners* listeners = findListeners(*storage, event); listeners) {
+        const std::type_info* signature = getSignature<ArgumentType<Args>...>();
+        EmitScope scope{*storage};
+
+        // The listeners are neither moved nor destroyed until the scope ends
+        for (Listener& listener : *listeners) {
+            if (listener.isSuspended_ || listener.isRemoved_ || !isSameSignature(listener.signature_, signature))
+                continue;
+
+            if (listener.isCalledOnce_) {
+                markRemoved(*storage, *listeners, listener);
+#ifdef IME_ENABLE_EVENT_STATS
+                recorder.onOnceListenerRemoved();
+#endif
             }
+
+#ifdef IME_ENABLE_EVENT_STATS
+            recorder.onListenerInvoked();
+#endif
+            std::invoke(listener.getCallback<ArgumentType<Args>...>(), args...);
         }
     }
 }
+
+template<typename... Args>
+const std::type_info* EventEmitter::getSignature() {
+    static const std::type_info* const signature = &typeid(void(Args...));
+    return signature;
+}
+
+template<typename... Args>
+EventEmitter::Listener::Listener(int id, Callback<Args...> callback, bool isCalledOnce) :
+    id_{id},
+    isSuspended_{false},
+    isCalledOnce_{isCalledOnce},
+    isRemoved_{false},
+    signature_{getSignature<Args...>()},
+    operations_{getOperations<Args...>()}
+{
+    static_assert(sizeof(Callback<Args...>) <= sizeof(callback_) && alignof(Callback<Args...>) <= alignof(Callback<>),
+        "Callback does not fit into the listener storage");
+
+    new (callback_) Callback<Args...>(std::move(callback));
+}
+
+template<typename... Args>
+Callback<Args...>& EventEmitter::Listener::getCallback() {
+    return *std::launder(reinterpret_cast<Callback<Args...>*>(callback_));
+}
+
+template<typename... Args>
+const EventEmitter::Listener::Operations* EventEmitter::Listener::getOperations() {
+    using CallbackType = Callback<Args...>;
+
+    static constexpr Operations operations{
+        [](void* destination, const void* source) {
+            new (destination) CallbackType(*static_cast<const CallbackType*>(source));
+        },
+        [](void* destination, void* source) noexcept {
+            new (destination) CallbackType(std::move(*static_cast<CallbackType*>(source)));
+        },
+        [](void* callback) noexcept {
+            static_cast<CallbackType*>(callback)->~CallbackType();
+        }
+    };
+
+    return &operations;
+}
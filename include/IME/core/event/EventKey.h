@@ -0,0 +1,134 @@
+////////////////////////////////////////////////////////////////////////////////
+// IME - Infinite Motion Engine
+//
+// Copyright (c) 2020-2022 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef IME_EVENTKEY_H
+#define IME_EVENTKEY_H
+
+#include "IME/Config.h"
+#include <string>
+#include <string_view>
+
+namespace ime {
+    /**
+     * @brief The name of an event together with its hash
+     *
+     * Event emitters look events up by hash. An event key computes the
+     * hash of an event name once, when it is constructed, such that
+     * emitting or subscribing to an event does not rehash its name. When
+     * constructed from a string literal in a constant expression, the hash
+     * is computed at compile time:
+     *
+     * @code
+     * static constexpr ime::EventKey clickEvent{"click"};
+     * emitter.emit(clickEvent);
+     * @endcode
+     *
+     * An event key does not copy the name, it refers to it. Therefore the
+     * name must outlive the key. This is always the case for string
+     * literals and for keys that are constructed implicitly when a name
+     * is passed to a function that expects a key
+     */
+    class EventKey {
+    public:
+        /**
+         * @brief Construct a key from a null terminated event name
+         * @param name The name of the event
+         */
+        constexpr EventKey(const char* name) :
+            EventKey(std::string_view(name))
+        {}
+
+        /**
+         * @brief Construct a key from an event name
+         * @param name The name of the event
+         */
+        constexpr EventKey(std::string_view name) :
+            name_{name},
+            hash_{computeHash(name)}
+        {}
+
+        /**
+         * @brief Construct a key from an event name
+         * @param name The name of the event
+         */
+        EventKey(const std::string& name) :
+            EventKey(std::string_view(name))
+        {}
+
+        /**
+         * @brief Get the name of the event
+         * @return The name of the event
+         */
+        constexpr std::string_view getName() const {
+            return name_;
+        }
+
+        /**
+         * @brief Get the hash of the event name
+         * @return The hash of the event name
+         */
+        constexpr Uint64 getHash() const {
+            return hash_;
+        }
+
+        /**
+         * @brief Compute the hash of an event name
+         * @param name The event name to be hashed
+         * @return The 64-bit FNV-1a hash of @a name
+         */
+        static constexpr Uint64 computeHash(std::string_view name) {
+            Uint64 hash = 14695981039346656037ULL;
+            for (char c : name) {
+                hash ^= static_cast<unsigned char>(c);
+                hash *= 1099511628211ULL;
+            }
+
+            return hash;
+        }
+
+        /**
+         * @brief Check if two keys refer to the same event
+         * @param other The key to compare against
+         * @return True if the keys have the same name, otherwise false
+         */
+        constexpr bool operator==(const EventKey& other) const {
+            return hash_ == other.hash_ && name_ == other.name_;
+        }
+
+        /**
+         * @brief Check if two keys refer to different events
+         * @param other The key to compare against
+         * @return True if the keys have different names, otherwise false
+         */
+        constexpr bool operator!=(const EventKey& other) const {
+            return !(*this == other);
+        }
+
+    private:
+        std::string_view name_; //!< The name of the event
+        Uint64 hash_;           //!< The hash of the event name
+    };
+}
+
+#endif // IME_EVENTKEY_H
@@ -0,0 +1,170 @@
+////////////////////////////////////////////////////////////////////////////////
+// IME - Infinite Motion Engine
+//
+// Copyright (c) 2020-2022 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef IME_EVENTMASK_H
+#define IME_EVENTMASK_H
+
+#include "IME/Config.h"
+#include "IME/core/event/Event.h"
+#include <initializer_list>
+
+namespace ime {
+    /**
+     * @brief A set of system event types
+     *
+     * Event masks are used to route system events only to the parts of
+     * the engine that are interested in them
+     */
+    class EventMask {
+    public:
+        /**
+         * @brief Default constructor
+         *
+         * Constructs an empty mask
+         */
+        constexpr EventMask() = default;
+
+        /**
+         * @brief Construct a mask from a list of event types
+         * @param types The event types in the mask
+         */
+        constexpr EventMask(std::initializer_list<Event::Type> types) {
+            for (auto type : types)
+                add(type);
+        }
+
+        /**
+         * @brief Get a mask that contains every event type
+         * @return A mask that contains every event type
+         */
+        static constexpr EventMask all() {
+            EventMask mask;
+            mask.bits_ = ~Uint32{0};
+            return mask;
+        }
+
+        /**
+         * @brief Add an event type to the mask
+         * @param type The event type to be added
+         * @return A reference to this mask
+         */
+        constexpr EventMask& add(Event::Type type) {
+            bits_ |= toBit(type);
+            return *this;
+        }
+
+        /**
+         * @brief Remove an event type from the mask
+         * @param type The event type to be removed
+         * @return A reference to this mask
+         */
+        constexpr EventMask& remove(Event::Type type) {
+            bits_ &= ~toBit(type);
+            return *this;
+        }
+
+        /**
+         * @brief Check if the mask contains an event type
+         * @param type The event type to be checked
+         * @return True if the mask contains @a type, otherwise false
+         */
+        constexpr bool contains(Event::Type type) const {
+            return (bits_ & toBit(type)) != 0;
+        }
+
+        /**
+         * @brief Check if the mask shares at least one event type with
+         *        another mask
+         * @param other The mask to check against
+         * @return True if the masks intersect, otherwise false
+         */
+        constexpr bool intersects(const EventMask& other) const {
+            return (bits_ & other.bits_) != 0;
+        }
+
+        /**
+         * @brief Check if the mask is empty
+         * @return True if the mask contains no event type, otherwise false
+         */
+        constexpr bool isEmpty() const {
+            return bits_ == 0;
+        }
+
+        /**
+         * @brief Get the union of two masks
+         * @param other The mask to combine with this mask
+         * @return A mask that contains the event types of both masks
+         */
+        constexpr EventMask operator|(const EventMask& other) const {
+            EventMask mask;
+            mask.bits_ = bits_ | other.bits_;
+            return mask;
+        }
+
+        /**
+         * @brief Check if two masks contain the same event types
+         * @param other The mask to compare against
+         * @return True if the masks are equal, otherwise false
+         */
+        constexpr bool operator==(const EventMask& other) const {
+            return bits_ == other.bits_;
+        }
+
+        /**
+         * @brief Check if two masks contain different event types
+         * @param other The mask to compare against
+         * @return True if the masks are not equal, otherwise false
+         */
+        constexpr bool operator!=(const EventMask& other) const {
+            return !(*this == other);
+        }
+
+    private:
+        /**
+         * @brief Get the bit that represents an event type
+         * @param type The event type
+         * @return The bit of @a type or 0 if the type is unknown
+         */
+        static constexpr Uint32 toBit(Event::Type type) {
+            return type == Event::Unknown ? 0 : Uint32{1} << static_cast<Uint32>(type);
+        }
+
+    private:
+        Uint32 bits_ = 0; //!< A bit for each event type in the mask
+    };
+
+    /**
+     * @brief Event masks of commonly grouped event types
+     */
+    namespace EventMasks {
+        constexpr EventMask Keyboard{Event::KeyPressed, Event::KeyReleased};                       //!< Keyboard key events
+        constexpr EventMask Mouse{Event::MouseWheelScrolled, Event::MouseButtonPressed,
+            Event::MouseButtonReleased, Event::MouseMoved};                                         //!< Mouse button, wheel and move events
+        constexpr EventMask Joystick{Event::JoystickButtonPressed, Event::JoystickButtonReleased,
+            Event::JoystickMoved, Event::JoystickConnected, Event::JoystickDisconnected};           //!< Joystick events
+        constexpr EventMask Input = Keyboard | Mouse | Joystick;                                    //!< All input device events
+    }
+}
+
+#endif // IME_EVENTMASK_H
@@ -0,0 +1,152 @@
+////////////////////////////////////////////////////////////////////////////////
+// IME - Infinite Motion Engine
+//
+// Copyright (c) 2020-2022 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef IME_EVENTSTATS_H
+#define IME_EVENTSTATS_H
+
+#include "IME/Config.h"
+#include "IME/core/event/EventKey.h"
+#include "IME/core/time/Time.h"
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace ime {
+    /**
+     * @brief Event system statistics of a single frame
+     *
+     * The statistics are only collected if IME is built with the
+     * IME_ENABLE_EVENT_STATS CMake option, otherwise they are always empty
+     * and the event system does not pay anything for them
+     *
+     * @see ime::Engine::getEventStats
+     */
+    struct IME_API EventStats {
+        /**
+         * @brief Statistics of a single event
+         */
+        struct Entry {
+            std::string name;                //!< The name of the event
+            Uint64 emitCount = 0;            //!< The number of times the event was emitted
+            Uint64 listenersInvoked = 0;     //!< The number of listeners that were invoked
+            Uint64 onceListenersRemoved = 0; //!< The number of one-time listeners that were removed after being invoked
+            Time dispatchTime;               //!< The time spent emitting the event, including events emitted by its listeners
+        };
+
+        std::vector<Entry> events;         //!< The emitted events, the most expensive first
+        Uint64 emitCount = 0;              //!< The number of emits of all events
+        Uint64 listenersInvoked = 0;       //!< The number of listeners invoked by all events
+        Uint64 onceListenersRemoved = 0;   //!< The number of one-time listeners removed by all events
+        Uint64 queuedEventsDispatched = 0; //!< The number of queued events dispatched by ime::EventDispatcher
+        Time dispatchTime;                 //!< The time spent emitting events, nested emits are only counted once
+
+        /**
+         * @brief Check if event statistics are compiled in or not
+         * @return True if IME was built with IME_ENABLE_EVENT_STATS,
+         *         otherwise false
+         */
+        static constexpr bool isEnabled() {
+        #ifdef IME_ENABLE_EVENT_STATS
+            return true;
+        #else
+            return false;
+        #endif
+        }
+
+        /**
+         * @brief Get the statistics of an event
+         * @param name The name of the event
+         * @return The statistics of the event or a nullptr if the event
+         *         was not emitted in the frame
+         */
+        const Entry* find(const std::string& name) const;
+    };
+
+    namespace priv {
+        /**
+         * @internal
+         * @brief Records the statistics of a single emit
+         *
+         * The duration is measured from construction to destruction. It is
+         * safe to record emits from multiple threads
+         */
+        class IME_API EmitRecorder {
+        public:
+            /**
+             * @brief Start recording an emit
+             * @param event The event that is emitted
+             */
+            explicit EmitRecorder(const EventKey& event);
+
+            /**
+             * @brief Notify the recorder that a listener was invoked
+             */
+            void onListenerInvoked() { listenersInvoked_++; }
+
+            /**
+             * @brief Notify the recorder that a one-time listener was removed
+             */
+            void onOnceListenerRemoved() { onceListenersRemoved_++; }
+
+            /**
+             * @brief Stop recording and add the emit to the current frame
+             */
+            ~EmitRecorder();
+
+            EmitRecorder(const EmitRecorder&) = delete;
+            EmitRecorder& operator=(const EmitRecorder&) = delete;
+
+        private:
+            const EventKey& event_;                       //!< The event that is emitted
+            std::chrono::steady_clock::time_point start_; //!< The time at which the emit started
+            Uint64 listenersInvoked_;                     //!< The number of listeners invoked so far
+            Uint64 onceListenersRemoved_;                 //!< The number of one-time listeners removed so far
+            bool isOutermost_;                            //!< A flag indicating whether or not the emit is not nested in another emit
+        };
+
+        /**
+         * @internal
+         * @brief Add dispatched queued events to the current frame
+         * @param count The number of events that were dispatched
+         */
+        IME_API void recordQueuedEventsDispatched(std::size_t count);
+
+        /**
+         * @internal
+         * @brief Get the statistics of the current frame and start a new one
+         * @return The statistics collected since the last call
+         *
+         * Each engine collects the emits of its own threads and jobs, this
+         * function returns the statistics of the engine the calling thread
+         * belongs to. Emits of threads that do not belong to an engine are
+         * collected together
+         *
+         * @warning This function is called by the engine at the end of each
+         * frame, calling it elsewhere will split a frames statistics
+         */
+        IME_API EventStats collectEventStats();
+    }
+}
+
+#endif //IME_EVENTSTATS_H
@@ -294,7 +294,6 @@ namespace ime {
         private:
             EventEmitter eventEmitter_;             //!< Event publisher
             std::unordered_map<int, bool> wasDown_; //!< The state of a key in the previous frame
-            inline static std::unordered_map<std::string, Key> stringKeyPairs_{};
         };
     }
 
@@ -35,6 +35,7 @@
 namespace ime {
     class RigidBody;
     class Scene;
+    class GameObjectContainer;
 
     /**
      * @brief Class for modelling game objects (players, enemies etc...)
@@ -90,6 +91,23 @@ namespace ime {
          */
         GameObject::Ptr copy() const;
 
+        /**
+         * @brief Restore the default state of the game object
+         *
+         * The state is set to -1, the user data is cleared, the game object
+         * is moved to the origin with zero rotation and a scale of 1 and it
+         * is activated. The rigid body (if any) is reset as well, see
+         * ime::RigidBody::reset.
+         *
+         * The sprite, the rigid body's colliders and the event listeners are
+         * kept. Note that ime::GameObjectPool does not use this function to
+         * recycle game objects, it restores them from their prototype
+         *
+         * @warning This function must not be called inside a physics world
+         * callback
+         */
+        void reset();
+
         /**
          * @brief Set current state
          * @param state The current state
@@ -354,7 +372,7 @@ namespace ime {
          * @warning This function is intended for internal use only and should
          * never be called outside of IME
          */
-        void emitRigidBodyCollisionEvent(const std::string& event, GameObject* other);
+        void emitRigidBodyCollisionEvent(const EventKey& event, GameObject* other);
 
         /**
          * @brief Destructor
@@ -367,6 +385,20 @@ namespace ime {
          */
         void initEvents();
 
+        /**
+         * @brief Restore the game object to a copy of its prototype
+         * @param prototype The game object this game object was copied from
+         *
+         * The tag, the state, the sprite, the transform, the rigid body
+         * velocities and the event listeners of the game object are replaced
+         * by those of @a prototype and its user data is cleared. Event
+         * listeners of the transform, the sprite and the rigid body are kept.
+         *
+         * The game object must be inactive, it is activated last such that
+         * its rigid body enters the physics simulation at its new position
+         */
+        void restore(const GameObject& prototype);
+
     private:
         std::reference_wrapper<Scene> scene_; //!< The scene this game object belongs to
         int state_;                           //!< The current state of the game object
@@ -376,7 +408,12 @@ namespace ime {
         BodyPtr body_;                        //!< The rigid body attached to this game object
         int postStepId_;                      //!< Scene post step handler id
         int destructionId_;                   //!< Scene destruction listener id
+        int transformId_;                     //!< Transform property change listener id
+        int transformDirtyId_;                //!< Transform dirty listener id
+        GameObjectContainer* container_;      //!< The scene container that flushes the deferred transform
         PropertyContainer userData_;          //!< Used to store metadata about the object
+        friend class GameObjectPool;          //!< Needs access to restore
+        friend class GameObjectContainer;     //!< Needs access to the container
     };
 }
 
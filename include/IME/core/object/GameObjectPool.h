@@ -0,0 +1,232 @@
+////////////////////////////////////////////////////////////////////////////////
+// IME - Infinite Motion Engine
+//
+// Copyright (c) 2020-2022 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef IME_GAMEOBJECTPOOL_H
+#define IME_GAMEOBJECTPOOL_H
+
+#include "IME/Config.h"
+#include "IME/core/object/GameObject.h"
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ime {
+    /**
+     * @brief Recycles game objects created from prototypes
+     */
+    class IME_API GameObjectPool {
+    public:
+        /**
+         * @brief Default constructor
+         */
+        GameObjectPool();
+
+        /**
+         * @brief Copy constructor
+         */
+        GameObjectPool(const GameObjectPool&) = delete;
+
+        /**
+         * @brief Copy assignment operator
+         */
+        GameObjectPool& operator=(const GameObjectPool&) = delete;
+
+        /**
+         * @brief Move constructor
+         */
+        GameObjectPool(GameObjectPool&&) noexcept;
+
+        /**
+         * @brief Move assignment operator
+         */
+        GameObjectPool& operator=(GameObjectPool&&) noexcept;
+
+        /**
+         * @brief Add a prototype to the pool
+         * @param key The unique key of the prototype
+         * @param prototype The game object new instances are copied from
+         *
+         * The prototype is deactivated such that its rigid body (if any)
+         * does not take part in the physics simulation. It must not be
+         * added to a scene
+         *
+         * @warning The key must not already be in use
+         *
+         * @see removePrototype and acquire
+         */
+        void addPrototype(const std::string& key, GameObject::Ptr prototype);
+
+        /**
+         * @brief Check if the pool has a prototype with the given key
+         * @param key The key of the prototype to be checked
+         * @return True if the pool has the prototype, otherwise false
+         */
+        bool hasPrototype(const std::string& key) const;
+
+        /**
+         * @brief Remove a prototype from the pool
+         * @param key The key of the prototype to be removed
+         * @return True if the prototype was removed or false if the pool
+         *         does not have a prototype with the given key
+         *
+         * The prototype and its available instances are destroyed. Acquired
+         * instances are not affected but they can no longer be released
+         * to the pool
+         */
+        bool removePrototype(const std::string& key);
+
+        /**
+         * @brief Create instances of a prototype in advance
+         * @param key The key of the prototype
+         * @param count The number of available instances to have
+         *
+         * This function creates instances until the pool has @a count
+         * available instances of the prototype, such that they do not have
+         * to be created when they are acquired
+         *
+         * @warning The prototype must exist
+         */
+        void reserve(const std::string& key, std::size_t count);
+
+        /**
+         * @brief Get an instance of a prototype
+         * @param key The key of the prototype
+         * @return An active instance of the prototype
+         *
+         * A released instance is reused if there is one, otherwise a copy of
+         * the prototype is created. A reused instance is restored to a copy
+         * of the prototype: its tag, state, sprite, transform and rigid body
+         * velocities are copied from the prototype, its user data is cleared
+         * and its event listeners are replaced by those of the prototype.
+         * Listeners that all instances need should therefore be added to the
+         * prototype. Note that event listeners added to the transform, the
+         * sprite or the rigid body of an instance are not removed when it is
+         * reused
+         *
+         * @warning The prototype must exist
+         *
+         * @see release
+         */
+        GameObject::Ptr acquire(const std::string& key);
+
+        /**
+         * @brief Return an instance to the pool
+         * @param gameObject The instance to be returned
+         * @return True if the instance was returned or false if it was not
+         *         acquired from this pool, in which case it is destroyed
+         *
+         * The instance is deactivated until it is acquired again, its
+         * rigid body (if any) stops taking part in the physics simulation
+         * but it is not destroyed. Game objects that belong to a scene
+         * are removed from it with ime::GameObjectContainer::extractById
+         *
+         * @warning This function must not be called inside a physics world
+         * callback
+         */
+        bool release(GameObject::Ptr gameObject);
+
+        /**
+         * @brief Get the number of available instances of a prototype
+         * @param key The key of the prototype
+         * @return The number of instances that can be acquired without
+         *         creating a new one
+         */
+        std::size_t getAvailableCount(const std::string& key) const;
+
+        /**
+         * @brief Remove all prototypes and their available instances
+         *
+         * @see removePrototype
+         */
+        void clear();
+
+        /**
+         * @brief Destructor
+         */
+        ~GameObjectPool();
+
+    private:
+        /**
+         * @brief Create an instance of a prototype
+         * @param key The key of the prototype
+         * @return The created instance
+         */
+        GameObject::Ptr createInstance(const std::string& key);
+
+        /**
+         * @brief Stop tracking an instance when it is destroyed
+         * @param instance The instance to be tracked
+         */
+        void addDestructionListener(GameObject& instance);
+
+    private:
+        /**
+         * @brief The instances of a prototype
+         */
+        struct Pool {
+            GameObject::Ptr prototype;                //!< The game object instances are copied from
+            std::vector<GameObject::Ptr> available;   //!< Released instances
+        };
+
+        std::unordered_map<std::string, Pool> pools_;         //!< Pools by prototype key
+        std::unordered_map<unsigned int, std::string> keys_;  //!< The prototype key of each instance by object id
+        std::shared_ptr<GameObjectPool*> handle_;             //!< Refers to this pool from the destruction listeners of its instances
+    };
+}
+
+/**
+ * @class ime::GameObjectPool
+ * @ingroup core
+ *
+ * Creating a game object that has a rigid body allocates the game object,
+ * its sprite, the internal physics body and its fixtures. A pool avoids
+ * that cost for short-lived game objects such as projectiles: instead of
+ * being destroyed, an instance is released to the pool, which keeps it
+ * (including its rigid body and colliders) inactive until it is acquired
+ * again.
+ *
+ * Every scene has a pool, which is accessible through
+ * ime::Scene::getGameObjectPool.
+ *
+ * Usage example:
+ * @code
+ * // Register a prototype once
+ * ime::GameObject::Ptr bullet = ime::GameObject::create(scene);
+ * bullet->attachRigidBody(scene.getPhysicsEngine().createBody(ime::RigidBody::Type::Kinematic));
+ * bullet->getRigidBody()->attachCollider(ime::CircleCollider::create(2.0f));
+ * pool.addPrototype("bullet", std::move(bullet));
+ * pool.reserve("bullet", 500);
+ *
+ * // Spawn
+ * ime::GameObject::Ptr spawned = pool.acquire("bullet");
+ * spawned->getTransform().setPosition(gunPosition);
+ * unsigned int id = scene.getGameObjects().add(std::move(spawned))->getObjectId();
+ *
+ * // Despawn (outside of a physics world callback)
+ * pool.release(scene.getGameObjects().extractById(id));
+ * @endcode
+ */
+
+#endif //IME_GAMEOBJECTPOOL_H
@@ -28,6 +28,7 @@
 #include "IME/Config.h"
 #include "IME/core/event/EventEmitter.h"
 #include "IME/common/Property.h"
+#include "IME/common/PropertyChange.h"
 #include <unordered_map>
 #include <functional>
 #include <string>
@@ -59,12 +60,12 @@ namespace ime {
         /**
          * @brief Move constructor
          */
-        Object(Object&&) noexcept = default;
+        Object(Object&&) noexcept;
 
         /**
          * @brief Move assignment operator
          */
-        Object& operator=(Object&&) noexcept = default;
+        Object& operator=(Object&&) noexcept;
 
         /**
          * @brief Assign the object an alias
@@ -183,6 +184,33 @@ namespace ime {
          */
         int onPropertyChange(const Callback<Property>& callback, bool oneTime = false);
 
+        /**
+         * @brief Add an event listener to any property change event that
+         *        receives a typed, non-allocating notification
+         * @param callback The function to be executed when any property changes
+         * @param oneTime True to execute the callback one-time or false to
+         *                execute it every time the event is triggered
+         * @return The unique id of the event listener
+         *
+         * This function is a cheaper alternative to onPropertyChange(). The
+         * notification refers to the name and value of the property instead
+         * of copying them into an ime::Property. If an object has no
+         * listeners that take an ime::Property, changing its properties does
+         * not construct one
+         *
+         * @code
+         * player.onTypedPropertyChange([](const ime::PropertyChange& change) {
+         *     if (change.id == ime::PropertyChange::idOf("position")) {
+         *         const auto& position = std::get<ime::Vector2f>(change.value);
+         *         ...
+         *     }
+         * });
+         * @endcode
+         *
+         * @see onPropertyChange(const ime::Callback<ime::Property>&)
+         */
+        int onTypedPropertyChange(const Callback<const PropertyChange&>& callback, bool oneTime = false);
+
         /**
          * @brief Pause or resume execution of an event listener
          * @param id The event listeners unique identification number
@@ -268,12 +296,28 @@ namespace ime {
          * @param property The property that changed
          *
          * This function will invoke all the event listeners of the specified
-         * property
+         * property, including typed property change listeners. A typed
+         * listener is passed the value if it is of a type of ime::PropertyValue
+         * (or an std::string), otherwise it is passed an ime::AnyPropertyValue
+         * that refers to @a property
          *
-         * @see emit
+         * @see emitChange(const EventKey&, const T&)
          */
         void emitChange(const Property& property);
 
+        /**
+         * @brief Dispatch a property change event
+         * @param property The name of the property that changed
+         * @param value The new value of the property
+         *
+         * Unlike emitChange(const Property&), this function does not
+         * construct an ime::Property unless there are event listeners that
+         * take one. If the object has no property change listeners at all,
+         * this function does nothing
+         */
+        template <typename T>
+        void emitChange(const EventKey& property, const T& value);
+
         /**
          * @brief Emit a destruction event
          *
@@ -286,12 +330,46 @@ namespace ime {
         void emitDestruction();
 
         // Members
-        EventEmitter eventEmitter_; //!< Event dispatcher
+        EventEmitter eventEmitter_{EventEmitter::ThreadingPolicy::SingleThreaded}; //!< Event dispatcher
+
+    private:
+        /**
+         * @brief Check if there are listeners to typed property changes
+         * @return True if there is at least one listener, otherwise false
+         */
+        bool hasTypedPropertyChangeListeners() const;
+
+        /**
+         * @brief Check if there are listeners that take an ime::Property
+         *        for a change of a property
+         * @param property The name of the property
+         * @return True if there is at least one listener, otherwise false
+         */
+        bool hasPropertyChangeListeners(const EventKey& property) const;
+
+        /**
+         * @brief Dispatch a typed property change event
+         * @param change The property change
+         */
+        void emitTypedChange(const PropertyChange& change);
+
+        /**
+         * @brief Dispatch a property change event to the listeners that
+         *        take an ime::Property
+         * @param property The property that changed
+         */
+        void emitUntypedChange(const Property& property);
 
     private:
-        unsigned int id_;   //!< The id of the object
-        std::string tag_;   //!< The object's tag
+        unsigned int id_;                 //!< The id of the object
+        std::string tag_;                 //!< The object's tag
+        bool hasNamedPropertyListeners_;  //!< A flag indicating whether or not a listener was ever added to a specific property
+        Callback<> tagIndexUpdater_;      //!< Keeps the tag index of the container that stores the object up to date
+        template <typename T>
+        friend class ObjectContainer;     //!< Needs access to the tag index updater
     };
+
+    #include "IME/core/object/Object.inl"
 }
 
 /**
@@ -27,11 +27,14 @@
 
 #include "IME/Config.h"
 #include "IME/core/object/Object.h"
+#include "IME/core/engine/JobSystem.h"
 #include <memory>
-#include <list>
 #include <algorithm>
 #include <functional>
 #include <unordered_map>
+#include <iterator>
+#include <string>
+#include <vector>
 
 namespace ime {
     /**
@@ -64,12 +67,12 @@ namespace ime {
         /**
          * @brief Move constructor
          */
-        ObjectContainer(ObjectContainer&&) noexcept = default;
+        ObjectContainer(ObjectContainer&& other) noexcept;
 
         /**
          * @brief Move assignment operator
          */
-        ObjectContainer& operator=(ObjectContainer&&) noexcept = default;
+        ObjectContainer& operator=(ObjectContainer&& other) noexcept;
         
         /**
          * @brief Add an object to the container
@@ -131,6 +134,8 @@ namespace ime {
          * @param id The id of the object to be retrieved
          * @return The object with the given id or a nullptr if the object
          *         could not be found in the container
+         *
+         * Objects are indexed by id, so the lookup takes constant time
          */
         T* findById(unsigned int id);
         const T* findById(unsigned int id) const;
@@ -188,6 +193,18 @@ namespace ime {
          */
         void removeById(unsigned int id);
 
+        /**
+         * @brief Remove an object with the given id without destroying it
+         * @param id The id of the object to be removed
+         * @return The removed object or a nullptr if the container does not
+         *         have an object with the given id
+         *
+         * Unlike removeById, the ownership of the object is transferred to
+         * the caller, so it can be added to another container or reused
+         * later (see ime::GameObjectPool)
+         */
+        ObjectPtr extractById(unsigned int id);
+
         /**
          * @brief Remove an object from the container
          * @param object The object to be removed
@@ -303,6 +320,12 @@ namespace ime {
          * Note that the callback is applied to all objects, this includes
          * those that are assigned to groups
          *
+         * The callback may add and remove objects and groups. Removed
+         * objects are immediately excluded from lookups and from the rest
+         * of the iteration, but they are only destroyed when the outermost
+         * iteration ends, so the callback may remove the object it was
+         * given. Objects that are added are visited by the next iteration
+         *
          * @see forEachInGroup and forEachNotInGroup
          */
         void forEach(const Callback<T*>& callback) const;
@@ -355,14 +378,192 @@ namespace ime {
          */
         void forEachNotInGroup(const Callback<T*>& callback) const;
 
+        /**
+         * @brief Apply a callback function to each object in the container
+         *        in parallel
+         * @param jobSystem The job system that executes the callback
+         * @param callback The function to be applied to each object
+         * @param grainSize The number of objects processed by a single job
+         * @throws Any exception thrown by @a callback
+         *
+         * The objects of the container and its groups are split into
+         * chunks of @a grainSize objects which are distributed among the
+         * worker threads of @a jobSystem (see ime::JobSystem::parallelFor).
+         * This function blocks until the callback has been applied to
+         * every object
+         *
+         * The callback is invoked concurrently from the worker threads and
+         * the calling thread, therefore it must obey the following rules:
+         *  - It may modify the object it was given, but not the other
+         *    objects in the container
+         *  - It must not add or remove objects or groups, neither to this
+         *    container nor to its groups
+         *  - Object property changes are emitted on the thread that invokes
+         *    the callback, so the callback must not modify objects whose
+         *    listeners access shared state unless those listeners are
+         *    thread safe
+         *  - The scene, the engine and their subsystems (physics, audio,
+         *    input, the grid, etc.) are not thread safe. They may be read
+         *    but any change must be handed back to the main thread with
+         *    ime::JobSystem::runOnMainThread
+         *
+         * Use forEach for callbacks that do not satisfy these rules
+         *
+         * @see parallelForEachInGroup and forEach
+         */
+        void parallelForEach(JobSystem& jobSystem, const Callback<T*>& callback,
+            std::size_t grainSize = 0) const;
+
+        /**
+         * @brief Apply a callback to each object in a specific group in
+         *        parallel
+         * @param jobSystem The job system that executes the callback
+         * @param name The name of the group to apply callback on
+         * @param callback The function to be applied to each object in the
+         *                 group
+         * @param grainSize The number of objects processed by a single job
+         * @throws Any exception thrown by @a callback
+         *
+         * The callback must obey the same rules as the one passed to
+         * parallelForEach. This function does nothing if the group does
+         * not exist
+         *
+         * @see parallelForEach and forEachInGroup
+         */
+        void parallelForEachInGroup(JobSystem& jobSystem, const std::string& name,
+            const Callback<T*>& callback, std::size_t grainSize = 0) const;
+
         /**
          * @brief Destructor
          */
-        virtual ~ObjectContainer() = default;
+        virtual ~ObjectContainer();
 
     private:
-        std::list<ObjectPtr> objects_;
-        std::unordered_map<std::string, std::unique_ptr<ObjectContainer<T>>> groups_;
+        /**
+         * @brief Where an indexed object is stored
+         */
+        struct IndexEntry {
+            std::size_t index;         //!< The index of the object in the storage of its owner
+            ObjectContainer<T>* owner; //!< The container (this or a nested group) that stores the object
+            std::string tag;           //!< The tag the object is indexed under
+        };
+
+        /**
+         * @brief Add an object to the indexes of this container and its
+         *        ancestors
+         * @param id The id of the object
+         * @param entry Where the object is stored
+         */
+        void indexObject(unsigned int id, const IndexEntry& entry);
+
+        /**
+         * @brief Remove an object from the indexes of this container and
+         *        its ancestors
+         * @param id The id of the object
+         * @param tag The tag the object is indexed under
+         */
+        void unindexObject(unsigned int id, const std::string& tag);
+
+        /**
+         * @brief Add all the objects of this container to the indexes of
+         *        its ancestors
+         */
+        void indexInAncestors();
+
+        /**
+         * @brief Remove all the objects of this container from the indexes
+         *        of its ancestors
+         */
+        void unindexFromAncestors();
+
+        /**
+         * @brief Remove an id from the tag index
+         * @param tag The tag the object is indexed under
+         * @param id The id of the object
+         */
+        void eraseTag(const std::string& tag, unsigned int id);
+
+        /**
+         * @brief Remove and destroy an indexed object
+         * @param id The id of the object
+         */
+        void eraseObject(unsigned int id);
+
+        /**
+         * @brief Remove the empty slots left by removed objects if they
+         *        make up more than half of the storage
+         *
+         * The remaining objects keep their relative order. The storage is
+         * not compacted while it is iterated
+         */
+        void compactIfSparse();
+
+        /**
+         * @brief Destroy the objects and groups that were removed and
+         *        compact the storage after an iteration
+         */
+        void applyDeferredChanges();
+
+        /**
+         * @brief Marks a container and its ancestors as being iterated
+         *
+         * While a container is iterated, removed objects and groups are
+         * kept alive and the storage is not compacted. The deferred
+         * changes of each container are applied when its outermost
+         * iteration ends
+         */
+        struct IterationScope {
+            explicit IterationScope(const ObjectContainer<T>& container) :
+                container_{container}
+            {
+                for (const ObjectContainer<T>* c = &container_; c; c = c->parent_)
+                    ++c->iterationDepth_;
+            }
+
+            ~IterationScope() {
+                // Changes can only be deferred through non-const access to the container
+                auto* container = const_cast<ObjectContainer<T>*>(&container_);
+                while (container) {
+                    ObjectContainer<T>* parent = container->parent_;
+                    if (--container->iterationDepth_ == 0)
+                        container->applyDeferredChanges();
+
+                    container = parent;
+                }
+            }
+
+            const ObjectContainer<T>& container_;
+        };
+
+        /**
+         * @brief Get the objects of this container and its groups
+         * @param objects The vector to append the objects to
+         */
+        void collectObjects(std::vector<T*>& objects) const;
+
+        /**
+         * @brief Make an object stored by this container reindex itself
+         *        when its tag changes
+         * @param object The object
+         */
+        void setTagIndexUpdater(T& object);
+
+        /**
+         * @brief Reindex an object stored by this container after its tag
+         *        changed
+         * @param id The id of the object
+         */
+        void updateTag(unsigned int id);
+
+        std::vector<ObjectPtr> objects_;                                               //!< Objects that do not belong to a group, removed objects leave a nullptr until the next compaction
+        std::size_t emptySlotCount_;                                                   //!< The number of removed objects in the storage
+        mutable unsigned int iterationDepth_;                                          //!< The number of iterations of this container or its groups in progress
+        std::vector<ObjectPtr> removedObjects_;                                        //!< Objects removed during an iteration
+        std::vector<std::unique_ptr<ObjectContainer<T>>> removedGroups_;               //!< Groups removed during an iteration
+        std::unordered_map<std::string, std::unique_ptr<ObjectContainer<T>>> groups_;  //!< Groups of objects
+        ObjectContainer<T>* parent_;                                                   //!< The container this container is a group of
+        std::unordered_map<unsigned int, IndexEntry> idIndex_;                         //!< The objects of this container and its groups by id
+        std::unordered_multimap<std::string, unsigned int> tagIndex_;                  //!< The ids of the objects of this container and its groups by tag
     };
 
     #include "ObjectContainer.inl"
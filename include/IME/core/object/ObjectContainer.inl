@@ -23,17 +23,66 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 template <typename T>
-inline ObjectContainer<T>::ObjectContainer() {
+inline ObjectContainer<T>::ObjectContainer() :
+    emptySlotCount_{0},
+    iterationDepth_{0},
+    parent_{nullptr}
+{
     static_assert(std::is_base_of<Object, T>::value,"An ObjectContainer class can only store instances of classes derived from Object class");
 }
 
+template <typename T>
+inline ObjectContainer<T>::ObjectContainer(ObjectContainer&& other) noexcept :
+    ObjectContainer()
+{
+    *this = std::move(other);
+}
+
+template <typename T>
+inline ObjectContainer<T>& ObjectContainer<T>::operator=(ObjectContainer&& other) noexcept {
+    if (this != &other) {
+        removeAll();
+        other.unindexFromAncestors();
+
+        objects_ = std::move(other.objects_);
+        emptySlotCount_ = other.emptySlotCount_;
+        groups_ = std::move(other.groups_);
+        idIndex_ = std::move(other.idIndex_);
+        tagIndex_ = std::move(other.tagIndex_);
+        other.objects_.clear();
+        other.emptySlotCount_ = 0;
+        other.groups_.clear();
+        other.idIndex_.clear();
+        other.tagIndex_.clear();
+
+        // The tag index updaters of the moved objects refer to the container that stores them
+        for (auto& pair : idIndex_) {
+            if (pair.second.owner == &other) {
+                pair.second.owner = this;
+                setTagIndexUpdater(*objects_[pair.second.index]);
+            }
+        }
+
+        for (auto& group : groups_)
+            group.second->parent_ = this;
+
+        indexInAncestors();
+    }
+
+    return *this;
+}
+
 template <typename T>
 inline T* ObjectContainer<T>::addObject(ObjectPtr object, const std::string& group) {
     IME_ASSERT(object, "Object added to a container cannot be a nullptr");
 
     if (group == "none") {
+        compactIfSparse();
         objects_.push_back(std::move(object));
-        return objects_.back().get();
+        T* added = objects_.back().get();
+        setTagIndexUpdater(*added);
+        indexObject(added->getObjectId(), IndexEntry{objects_.size() - 1, this, added->getTag()});
+        return added;
     } else {
         if (hasGroup(group))
             return groups_.at(group)->addObject(std::move(object));
@@ -50,9 +99,22 @@ inline T* ObjectContainer<T>::findByTag(const std::string& tag) {
 
 template<typename T>
 inline const T* ObjectContainer<T>::findByTag(const std::string& tag) const {
-    return findIf([&tag](const T* object) {
-        return object->getTag() == tag;
-    });
+    // Objects that are not in a group come first, then the ones stored first
+    const IndexEntry* first = nullptr;
+    auto range = tagIndex_.equal_range(tag);
+    for (auto it = range.first; it != range.second; ++it) {
+        const IndexEntry& entry = idIndex_.at(it->second);
+        if (!first || (entry.owner == this && first->owner != this) ||
+            ((entry.owner == this) == (first->owner == this) && entry.index < first->index))
+        {
+            first = &entry;
+        }
+    }
+
+    if (first)
+        return first->owner->objects_[first->index].get();
+
+    return nullptr;
 }
 
 template <typename T>
@@ -74,9 +136,10 @@ inline T* ObjectContainer<T>::findById(unsigned int id) {
 
 template<typename T>
 inline const T* ObjectContainer<T>::findById(unsigned int id) const {
-    return findIf([id](const T* object) {
-        return object->getObjectId() == id;
-    });
+    if (auto found = idIndex_.find(id); found != idIndex_.end())
+        return found->second.owner->objects_[found->second.index].get();
+
+    return nullptr;
 }
 
 template <typename T>
@@ -99,7 +162,7 @@ inline T* ObjectContainer<T>::findIf(const Predicate& predicate) {
 template <typename T>
 inline const T* ObjectContainer<T>::findIf(const Predicate& predicate) const {
     auto found = std::find_if(objects_.begin(), objects_.end(), [&predicate](const ObjectPtr& uniquePtr) {
-        return predicate(uniquePtr.get());
+        return uniquePtr && predicate(uniquePtr.get());
     });
 
     if (found != objects_.end())
@@ -117,45 +180,68 @@ inline const T* ObjectContainer<T>::findIf(const Predicate& predicate) const {
 
 template <typename T>
 inline void ObjectContainer<T>::removeByTag(const std::string& tag) {
-    removeIf([&tag](const T* object) {
-        return object->getTag() == tag;
+    auto range = tagIndex_.equal_range(tag);
+    std::vector<unsigned int> ids;
+    std::transform(range.first, range.second, std::back_inserter(ids), [](const auto& pair) {
+        return pair.second;
     });
+
+    for (unsigned int id : ids)
+        eraseObject(id);
 }
 
 template <typename T>
 inline void ObjectContainer<T>::removeById(unsigned int id) {
-    removeIf([id](const T* object) {
-        return object->getObjectId() == id;
-    });
+    if (idIndex_.find(id) != idIndex_.end())
+        eraseObject(id);
 }
 
 template <typename T>
-inline bool ObjectContainer<T>::remove(T* object) {
-    if (object == nullptr)
-        return false;
+inline typename ObjectContainer<T>::ObjectPtr ObjectContainer<T>::extractById(unsigned int id) {
+    auto found = idIndex_.find(id);
+    if (found == idIndex_.end())
+        return nullptr;
 
-    for (auto iter = objects_.begin(); iter != objects_.end(); ++iter) {
-        if ((*iter)->getObjectId() == object->getObjectId()) {
-            objects_.erase(iter);
-            return true;
-        }
-    }
+    IndexEntry entry = found->second;
+    ObjectContainer<T>& owner = *entry.owner;
+    owner.unindexObject(id, entry.tag);
 
-    // Perform recursive remove
-    for (const auto& group : groups_) {
-        auto removed = group.second->remove(object);
-        if (removed)
-            return true;
-    }
+    ObjectPtr extracted = std::move(owner.objects_[entry.index]);
+    owner.emptySlotCount_++;
+    owner.compactIfSparse();
 
-    return false;
+    extracted->tagIndexUpdater_ = nullptr;
+    return extracted;
+}
+
+template <typename T>
+inline bool ObjectContainer<T>::remove(T* object) {
+    if (object == nullptr || idIndex_.find(object->getObjectId()) == idIndex_.end())
+        return false;
+
+    eraseObject(object->getObjectId());
+    return true;
 }
 
 template <typename T>
 inline void ObjectContainer<T>::removeIf(const Predicate& predicate) {
-    objects_.erase(std::remove_if(objects_.begin(), objects_.end(), [&predicate](const ObjectPtr& uniquePtr) {
-        return predicate(uniquePtr.get());
-    }), objects_.end());
+    // Removed objects are destroyed after the storage is consistent again
+    std::vector<ObjectPtr> removed;
+
+    for (ObjectPtr& object : objects_) {
+        if (object && predicate(object.get())) {
+            unsigned int id = object->getObjectId();
+            std::string tag = idIndex_.at(id).tag;
+            unindexObject(id, tag);
+            removed.push_back(std::move(object));
+            emptySlotCount_++;
+        }
+    }
+
+    if (iterationDepth_ > 0)
+        std::move(removed.begin(), removed.end(), std::back_inserter(removedObjects_));
+    else
+        compactIfSparse();
 
     // Perform recursive remove
     for (const auto& group : groups_)
@@ -164,23 +250,42 @@ inline void ObjectContainer<T>::removeIf(const Predicate& predicate) {
 
 template <typename T>
 inline void ObjectContainer<T>::removeAll() {
-    objects_.clear();
+    unindexFromAncestors();
+    idIndex_.clear();
+    tagIndex_.clear();
+
+    if (iterationDepth_ > 0) {
+        // Keep the slots, the iteration in progress refers to them by index
+        for (ObjectPtr& object : objects_) {
+            if (object) {
+                removedObjects_.push_back(std::move(object));
+                emptySlotCount_++;
+            }
+        }
+
+        for (auto& group : groups_) {
+            group.second->removeAll();
+            removedGroups_.push_back(std::move(group.second));
+        }
+    } else {
+        objects_.clear();
+        emptySlotCount_ = 0;
+    }
+
     groups_.clear();
 }
 
 template <typename T>
 inline std::size_t ObjectContainer<T>::getCount() const {
-    std::size_t count = 0;
-    for (const auto& group : groups_)
-        count += group.second->getCount();
-
-    return objects_.size() + count;
+    return idIndex_.size();
 }
 
 template <typename T>
 inline ObjectContainer<T>& ObjectContainer<T>::createGroup(const std::string& name) {
     IME_ASSERT(!hasGroup(name), "The group \"" + name + "\" already exists in the container");
-    return *(groups_.insert({name, std::make_unique<ObjectContainer<T>>()}).first->second);
+    ObjectContainer<T>& group = *(groups_.insert({name, std::make_unique<ObjectContainer<T>>()}).first->second);
+    group.parent_ = this;
+    return group;
 }
 
 template <typename T>
@@ -196,8 +301,16 @@ inline bool ObjectContainer<T>::hasGroup(const std::string& name) const {
 
 template <typename T>
 inline bool ObjectContainer<T>::removeGroup(const std::string& name) {
-    if (hasGroup(name)) {
-        groups_.erase(name);
+    if (auto found = groups_.find(name); found != groups_.end()) {
+        found->second->unindexFromAncestors();
+
+        // The group may be iterated, it is destroyed when the iteration ends
+        if (iterationDepth_ > 0) {
+            found->second->removeAll();
+            removedGroups_.push_back(std::move(found->second));
+        }
+
+        groups_.erase(found);
         return true;
     }
 
@@ -206,17 +319,34 @@ inline bool ObjectContainer<T>::removeGroup(const std::string& name) {
 
 template <typename T>
 inline void ObjectContainer<T>::removeAllGroups() {
+    for (auto& group : groups_) {
+        group.second->unindexFromAncestors();
+
+        if (iterationDepth_ > 0) {
+            group.second->removeAll();
+            removedGroups_.push_back(std::move(group.second));
+        }
+    }
+
     groups_.clear();
 }
 
 template <typename T>
 inline void ObjectContainer<T>::forEach(const Callback<T*>& callback) const {
+    IterationScope scope{*this};
+
+    // Groups created by the callback are visited by the next iteration and removed
+    // groups remain alive (and empty) until this iteration ends
+    std::vector<ObjectContainer<T>*> groups;
+    groups.reserve(groups_.size());
+    for (const auto& group : groups_)
+        groups.push_back(group.second.get());
+
     forEachNotInGroup(callback);
 
     // Recursively apply callback
-    std::for_each(groups_.begin(), groups_.end(), [&callback] (auto& pair) {
-        pair.second->forEach(callback);
-    });
+    for (ObjectContainer<T>* group : groups)
+        group->forEach(callback);
 }
 
 template <typename T>
@@ -231,9 +361,176 @@ inline void ObjectContainer<T>::forEachInGroups(const std::initializer_list<std:
         forEachInGroup(group, callback);
 }
 
+template <typename T>
+inline void ObjectContainer<T>::parallelForEach(JobSystem& jobSystem, const Callback<T*>& callback,
+    std::size_t grainSize) const
+{
+    IterationScope scope{*this};
+
+    // A flat snapshot balances the chunks across the groups
+    std::vector<T*> objects;
+    objects.reserve(getCount());
+    collectObjects(objects);
+
+    jobSystem.parallelFor(0, objects.size(), [&objects, &callback](std::size_t i) {
+        callback(objects[i]);
+    }, grainSize);
+}
+
+template <typename T>
+inline void ObjectContainer<T>::parallelForEachInGroup(JobSystem& jobSystem, const std::string& name,
+    const Callback<T*>& callback, std::size_t grainSize) const
+{
+    if (hasGroup(name))
+        groups_.at(name)->parallelForEach(jobSystem, callback, grainSize);
+}
+
+template <typename T>
+inline void ObjectContainer<T>::collectObjects(std::vector<T*>& objects) const {
+    for (const ObjectPtr& object : objects_) {
+        if (object)
+            objects.push_back(object.get());
+    }
+
+    for (const auto& group : groups_)
+        group.second->collectObjects(objects);
+}
+
 template <typename T>
 inline void ObjectContainer<T>::forEachNotInGroup(const Callback<T*>& callback) const {
-    std::for_each(objects_.begin(), objects_.end(), [&callback](const std::unique_ptr<T>& uniquePtr) {
-        callback(uniquePtr.get());
+    IterationScope scope{*this};
+
+    // Objects added by the callback are appended past the end and visited by the next iteration
+    const std::size_t count = objects_.size();
+    for (std::size_t i = 0; i < count; i++) {
+        if (objects_[i])
+            callback(objects_[i].get());
+    }
+}
+
+template <typename T>
+inline ObjectContainer<T>::~ObjectContainer() {
+    // The objects may outlive the indexes while the members are destroyed
+    for (auto* objects : {&objects_, &removedObjects_}) {
+        for (ObjectPtr& object : *objects) {
+            if (object)
+                object->tagIndexUpdater_ = nullptr;
+        }
+    }
+}
+
+template <typename T>
+inline void ObjectContainer<T>::indexObject(unsigned int id, const IndexEntry& entry) {
+    for (ObjectContainer<T>* container = this; container; container = container->parent_) {
+        container->idIndex_.emplace(id, entry);
+        container->tagIndex_.emplace(entry.tag, id);
+    }
+}
+
+template <typename T>
+inline void ObjectContainer<T>::unindexObject(unsigned int id, const std::string& tag) {
+    for (ObjectContainer<T>* container = this; container; container = container->parent_) {
+        container->eraseTag(tag, id);
+        container->idIndex_.erase(id);
+    }
+}
+
+template <typename T>
+inline void ObjectContainer<T>::indexInAncestors() {
+    for (ObjectContainer<T>* container = parent_; container; container = container->parent_) {
+        for (const auto& pair : idIndex_) {
+            container->idIndex_.emplace(pair.first, pair.second);
+            container->tagIndex_.emplace(pair.second.tag, pair.first);
+        }
+    }
+}
+
+template <typename T>
+inline void ObjectContainer<T>::unindexFromAncestors() {
+    for (ObjectContainer<T>* container = parent_; container; container = container->parent_) {
+        for (const auto& pair : idIndex_) {
+            container->eraseTag(pair.second.tag, pair.first);
+            container->idIndex_.erase(pair.first);
+        }
+    }
+}
+
+template <typename T>
+inline void ObjectContainer<T>::eraseTag(const std::string& tag, unsigned int id) {
+    auto range = tagIndex_.equal_range(tag);
+    auto found = std::find_if(range.first, range.second, [id](const auto& pair) {
+        return pair.second == id;
     });
+
+    if (found != range.second)
+        tagIndex_.erase(found);
+}
+
+template <typename T>
+inline void ObjectContainer<T>::eraseObject(unsigned int id) {
+    // The index is updated first, the object may access the container while it is destroyed
+    IndexEntry entry = idIndex_.at(id);
+    ObjectContainer<T>& owner = *entry.owner;
+    owner.unindexObject(id, entry.tag);
+
+    // Leave an empty slot, such that the indexes of the other objects remain valid
+    ObjectPtr removed = std::move(owner.objects_[entry.index]);
+    owner.emptySlotCount_++;
+
+    // The object may be the one an iteration in progress was given
+    if (owner.iterationDepth_ > 0)
+        owner.removedObjects_.push_back(std::move(removed));
+    else
+        owner.compactIfSparse();
+}
+
+template <typename T>
+inline void ObjectContainer<T>::applyDeferredChanges() {
+    compactIfSparse();
+
+    // Destroyed last, destructors may access the container
+    auto removedObjects = std::move(removedObjects_);
+    auto removedGroups = std::move(removedGroups_);
+    removedObjects_.clear();
+    removedGroups_.clear();
+}
+
+template <typename T>
+inline void ObjectContainer<T>::compactIfSparse() {
+    if (iterationDepth_ > 0 || emptySlotCount_ * 2 <= objects_.size())
+        return;
+
+    objects_.erase(std::remove(objects_.begin(), objects_.end(), nullptr), objects_.end());
+    emptySlotCount_ = 0;
+
+    for (std::size_t i = 0; i < objects_.size(); i++) {
+        for (ObjectContainer<T>* container = this; container; container = container->parent_)
+            container->idIndex_.at(objects_[i]->getObjectId()).index = i;
+    }
+}
+
+template <typename T>
+inline void ObjectContainer<T>::setTagIndexUpdater(T& object) {
+    // Small enough to be stored without an allocation
+    object.tagIndexUpdater_ = [container = this, id = object.getObjectId()] {
+        container->updateTag(id);
+    };
+}
+
+template <typename T>
+inline void ObjectContainer<T>::updateTag(unsigned int id) {
+    auto found = idIndex_.find(id);
+    if (found == idIndex_.end() || found->second.owner != this)
+        return;
+
+    std::string oldTag = found->second.tag;
+    const std::string& newTag = objects_[found->second.index]->getTag();
+    if (oldTag == newTag)
+        return;
+
+    for (ObjectContainer<T>* container = this; container; container = container->parent_) {
+        container->eraseTag(oldTag, id);
+        container->tagIndex_.emplace(newTag, id);
+        container->idIndex_.at(id).tag = newTag;
+    }
 }
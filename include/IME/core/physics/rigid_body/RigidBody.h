@@ -116,6 +116,22 @@ namespace ime {
          */
         RigidBody::Ptr copy() const;
 
+        /**
+         * @brief Restore the motion state of the body
+         *
+         * The body is moved to the origin of the world, its rotation is
+         * set to zero (unless the rotation is fixed), its velocities are
+         * cleared and it is woken up and enabled. The internal body, the
+         * colliders and the properties of the body (type, damping, gravity
+         * scale etc...) are kept, which makes resetting a body much cheaper
+         * than destroying it and creating a new one
+         *
+         * @warning This function is locked during callbacks
+         *
+         * @see ime::GameObject::reset
+         */
+        void reset();
+
         /**
          * @brief Get the name of this class
          * @return The name of this class
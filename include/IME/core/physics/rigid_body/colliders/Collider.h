@@ -445,7 +445,7 @@ namespace ime {
          * @warning This function is intended for internal use only and should
          * never be called outside of IME
          */
-        void emitContact(const std::string& event, Collider* other);
+        void emitContact(const EventKey& event, Collider* other);
 
         /**
          * @brief Destructor
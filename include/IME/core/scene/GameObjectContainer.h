@@ -29,6 +29,8 @@
 #include "IME/core/object/ObjectContainer.h"
 #include "IME/core/object/GameObject.h"
 #include "IME/core/scene/RenderLayerContainer.h"
+#include <mutex>
+#include <vector>
 
 namespace ime {
     /**
@@ -102,8 +104,76 @@ namespace ime {
         GameObject* add(const std::string& group, GameObject::Ptr gameObject,
              int renderOrder = 0u, const std::string& renderLayer = "default");
 
+        /**
+         * @brief Remove a game object with the given id without destroying it
+         * @param id The id of the game object to be removed
+         * @return The removed game object or a nullptr if the container does
+         *         not have a game object with the given id
+         *
+         * The sprite of the game object is removed from its render layer.
+         * The game object may be added back to the container with add() or
+         * returned to an ime::GameObjectPool
+         */
+        GameObject::Ptr extractById(unsigned int id);
+
+        /**
+         * @internal
+         * @brief Schedule the deferred transform of a game object to be
+         *        flushed by the next call to syncTransforms()
+         * @param id The id of the game object
+         *
+         * This function is thread safe
+         *
+         * @warning This function is intended for internal use only and
+         * should never be called outside of IME
+         */
+        void markTransformDirty(unsigned int id);
+
+        /**
+         * @internal
+         * @brief Flush the pending changes of deferred game object transforms
+         *
+         * Only the game objects whose transform became dirty since the
+         * last call are visited, see ime::Transform::setDeferredSyncEnabled
+         *
+         * @warning This function is intended for internal use only and
+         * should never be called outside of IME
+         */
+        void syncTransforms();
+
+        /**
+         * @internal
+         * @brief Add or remove a game object from the game objects that
+         *        are rendered at an interpolated state
+         * @param id The id of the game object
+         * @param interpolated True if the transform of the game object is
+         *                     interpolated, otherwise false
+         *
+         * @warning This function is intended for internal use only and
+         * should never be called outside of IME
+         */
+        void setTransformInterpolated(unsigned int id, bool interpolated);
+
+        /**
+         * @internal
+         * @brief Execute a callback for each game object whose transform
+         *        is interpolated
+         * @param callback The function to be executed
+         *
+         * Only the game objects whose transform has interpolation enabled
+         * are visited, see ime::Transform::setInterpolationEnabled
+         *
+         * @warning This function is intended for internal use only and
+         * should never be called outside of IME
+         */
+        void forEachInterpolated(const Callback<GameObject*>& callback);
+
     private:
         std::reference_wrapper<RenderLayerContainer> renderLayers_;
+        std::mutex dirtyTransformsMutex_;              //!< Synchronizes access to the dirty transforms
+        std::vector<unsigned int> dirtyTransforms_;    //!< Game objects whose transform must be flushed
+        std::vector<unsigned int> flushedTransforms_;  //!< Game objects whose transform is being flushed
+        std::vector<unsigned int> interpolated_;       //!< Game objects whose transform is interpolated
         using ObjectContainer<GameObject>::addObject;
     };
 }
@@ -29,6 +29,7 @@
 #include "IME/core/physics/grid/GridMover.h"
 #include "IME/core/object/ObjectContainer.h"
 #include "IME/core/event/Event.h"
+#include "IME/core/event/EventMask.h"
 #include "IME/core/time/Time.h"
 
 namespace ime {
@@ -63,6 +64,21 @@ namespace ime {
          */
         void handleEvent(Event event);
 
+        /**
+         * @internal
+         * @brief Get the system event types handled by grid movers
+         * @return The event types handled by grid movers
+         *
+         * Only keyboard controlled grid movers respond to system events,
+         * so events of other types need not be passed to handleEvent()
+         *
+         * @warning This function is intended for internal use only and
+         * should never be called outside of IME
+         */
+        static constexpr EventMask getEventMask() {
+            return EventMasks::Keyboard;
+        }
+
         /**
          * @internal
          * @brief Render the grid movers path
@@ -28,6 +28,7 @@
 #include "IME/Config.h"
 #include "IME/core/time/Time.h"
 #include "IME/core/event/Event.h"
+#include "IME/core/event/EventMask.h"
 #include "IME/core/event/EventDispatcher.h"
 #include "IME/core/input/InputManager.h"
 #include "IME/core/audio/AudioManager.h"
@@ -35,6 +36,7 @@
 #include "IME/common/PropertyContainer.h"
 #include "IME/common/PrefContainer.h"
 #include "IME/core/scene/GameObjectContainer.h"
+#include "IME/core/object/GameObjectPool.h"
 #include "IME/core/scene/RenderLayerContainer.h"
 #include "IME/core/scene/DrawableContainer.h"
 #include "IME/core/scene/GridMoverContainer.h"
@@ -49,6 +51,7 @@
 
 namespace ime {
     class Engine;
+    class JobSystem;
     class Window;
     class PhysicsEngine;
 
@@ -516,6 +519,30 @@ namespace ime {
          */
         bool isBackgroundSceneEventsEnabled() const;
 
+        /**
+         * @brief Set the system event types the scene is notified of
+         * @param mask The event types to be passed to onHandleEvent()
+         *
+         * Events whose type is not in the mask are not passed to the
+         * onHandleEvent() function. This avoids a virtual call per event
+         * for event types the scene is not interested in. Note that the
+         * mask does not affect the scene level input manager, gui and
+         * grid movers, they continue to receive the events they handle
+         *
+         * By default, the scene is notified of all event types
+         *
+         * @see getEventMask
+         */
+        void setEventMask(const EventMask& mask);
+
+        /**
+         * @brief Get the system event types the scene is notified of
+         * @return The event types passed to onHandleEvent()
+         *
+         * @see setEventMask
+         */
+        const EventMask& getEventMask() const;
+
         /**
          * @brief Cache or uncahe the scene
          * @param cache True to cache or false to uncache
@@ -711,6 +738,21 @@ namespace ime {
         TimerManager& getTimer();
         const TimerManager& getTimer() const;
 
+        /**
+         * @brief Get the engine level job system
+         * @return The engine level job system
+         * @throws AccessViolationException If this function is called before
+         *         the scene is initialized
+         *
+         * Jobs are executed on worker threads and may outlive the scene,
+         * they must not access the scene directly. Use
+         * ime::JobSystem::runOnMainThread to hand results back to the scene
+         *
+         * @see ime::Engine::getJobSystem
+         */
+        JobSystem& getJobSystem();
+        const JobSystem& getJobSystem() const;
+
         /**
          * @brief Get the engine level cache
          * @return The engine level cache
@@ -820,6 +862,19 @@ namespace ime {
         GameObjectContainer& getGameObjects();
         const GameObjectContainer& getGameObjects() const;
 
+        /**
+         * @brief Get the scene level game object pool
+         * @return The scene level game object pool
+         *
+         * The pool recycles game objects (including their rigid bodies
+         * and colliders) that are spawned and destroyed frequently. The
+         * pooled game objects are destroyed with the scene
+         *
+         * @warning Do not keep the returned reference
+         */
+        GameObjectPool& getGameObjectPool();
+        const GameObjectPool& getGameObjectPool() const;
+
         /**
          * @brief Get the scene level sprite container
          * @return The scene level sprite container
@@ -914,7 +969,7 @@ namespace ime {
         input::InputManager inputManager_;    //!< Scene level input manager
         audio::AudioManager audioManager_;    //!< Scene level audio manager
         EventEmitter eventEmitter_;           //!< scene level event dispatcher
-        EventEmitter internalEmitter_;        //!< Emits internal scene events
+        EventEmitter internalEmitter_{EventEmitter::ThreadingPolicy::SingleThreaded}; //!< Emits internal scene events
         TimerManager timerManager_;           //!< Scene level timer manager
         ui::GuiContainer guiContainer_;       //!< Scene level gui container
         RenderLayerContainer renderLayers_;   //!< Render layers for this scene
@@ -928,6 +983,7 @@ namespace ime {
         bool isBackgroundSceneDrawable_;      //!< A flag indicating whether or not the scenes background scene is rendered
         bool isBackgroundSceneUpdated_;       //!< A flag indicating whether or not the scenes background scene receives time updates
         bool isBackgroundSceneEventsEnabled_; //!< A flag indicating whether or not the scenes background scene receives system events
+        EventMask eventMask_;                 //!< The system event types passed to onHandleEvent()
         bool hasPhysicsSim_;                  //!< A flag indicating whether or not the scene has a physics simulation
         bool hasGrid2D_;                      //!< A flag indicating whether or not the scene has a grid
         std::pair<bool, std::string> cacheState_;
@@ -939,6 +995,7 @@ namespace ime {
         std::unique_ptr<std::reference_wrapper<Window>> window_;           //!< A reference to the game window
         std::unique_ptr<CameraContainer> cameraContainer_;                 //!< Stores cameras that belong to the scene
         std::unique_ptr<SpriteContainer> spriteContainer_;                 //!< Stores sprites that belong to the scene
+        std::unique_ptr<GameObjectPool> gameObjectPool_;                   //!< Recycles game objects that belong to the scene
         std::unique_ptr<GameObjectContainer> entityContainer_;             //!< Stores game objects that belong to the scene
         std::unique_ptr<ShapeContainer> shapeContainer_;                   //!< Stores shapes that belong to the scene
         std::unique_ptr<std::reference_wrapper<PropertyContainer>> cache_; //!< The engine level cache
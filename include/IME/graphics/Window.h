@@ -354,6 +354,8 @@ namespace ime {
          * @warning The frame rate limit must be greater than 0
          *
          * BY default the frame rate limit is 60 FPS
+         *
+         * @see ime::FramePacer
          */
         void setFrameRateLimit(unsigned int limit);
 
@@ -644,6 +646,7 @@ namespace ime {
         bool isVisible_;                     //!< A flag indicating whether or not the window is visible
         bool isCursorVisible_;               //!< A flag indicating whether or not the mouse cursor is visible
         bool isCursorGrabbed_;               //!< A flag indicating whether or not the mouse cursor is grabbed by the window
+        bool isPacedByEngine_;               //!< A flag indicating whether or not the frame rate limit is enforced by the engine instead of the window
         Vector2u sizeBeforeFullScreen_;      //!< The size of the window before full screen mode
         EventEmitter eventEmitter_;          //!< Dispatches events
         Colour clearColour_;                 //!< The fill colour of the window when cleared
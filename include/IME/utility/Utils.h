@@ -106,10 +106,10 @@ namespace ime {
                 // MinGW compiler on windows does not provide non-deterministic
                 // values from its std::random_device, so the random numbers
                 // are the same on every run
-                static auto randomEngine = std::mt19937(std::time(nullptr));
+                thread_local auto randomEngine = std::mt19937(std::time(nullptr));
                 return distribution(randomEngine);
 #else
-                static auto randomEngine = std::mt19937(std::random_device{}());
+                thread_local auto randomEngine = std::mt19937(std::random_device{}());
                 return distribution(randomEngine);
 #endif
             };
@@ -27,9 +27,27 @@
 #include <cmath>
 
 namespace ime {
+    namespace {
+        // Events are looked up by precomputed keys
+        constexpr EventKey transformPropertyChangeEvent{"propertyChange"};
+        constexpr EventKey transformDirtyEvent{"dirty"};
+
+        // Properties with pending change notifications
+        enum TransformDirtyFlag : Uint8 {
+            TransformPositionDirty = 1 << 0,
+            TransformRotationDirty = 1 << 1,
+            TransformScaleDirty = 1 << 2,
+            TransformOriginDirty = 1 << 3
+        };
+    }
+
     Transform::Transform() :
         scale_{1.0f, 1.0f},
-        rotation_{0.0f}
+        rotation_{0.0f},
+        prevRotation_{0.0f},
+        isInterpolated_{false},
+        isDeferred_{false},
+        dirtyFlags_{0}
     {}
 
     void Transform::setPosition(float x, float y) {
@@ -39,7 +57,10 @@ namespace ime {
         position_.x = x;
         position_.y = y;
 
-        eventEmitter_.emit("propertyChange", Property{"position", position_});
+        if (isDeferred_)
+            markDirty(TransformPositionDirty);
+        else
+            eventEmitter_.emit(transformPropertyChangeEvent, Property{"position", position_});
     }
 
     void Transform::setPosition(const Vector2f& position) {
@@ -59,7 +80,10 @@ namespace ime {
         if (rotation_ < 0)
             rotation_ += 360.f;
 
-        eventEmitter_.emit("propertyChange", Property{"rotation", rotation_});
+        if (isDeferred_)
+            markDirty(TransformRotationDirty);
+        else
+            eventEmitter_.emit(transformPropertyChangeEvent, Property{"rotation", rotation_});
     }
 
     void Transform::rotate(float angle) {
@@ -77,7 +101,10 @@ namespace ime {
         scale_.x = factorX;
         scale_.y = factorY;
 
-        eventEmitter_.emit("propertyChange", Property{"scale", scale_});
+        if (isDeferred_)
+            markDirty(TransformScaleDirty);
+        else
+            eventEmitter_.emit(transformPropertyChangeEvent, Property{"scale", scale_});
     }
 
     void Transform::setScale(const Vector2f& scale) {
@@ -103,7 +130,10 @@ namespace ime {
         origin_.x = x;
         origin_.y = y;
 
-        eventEmitter_.emit("propertyChange", Property{"origin", origin_});
+        if (isDeferred_)
+            markDirty(TransformOriginDirty);
+        else
+            eventEmitter_.emit(transformPropertyChangeEvent, Property{"origin", origin_});
     }
 
     void Transform::setOrigin(const Vector2f& origin) {
@@ -122,8 +152,101 @@ namespace ime {
         move(offset.x, offset.y);
     }
 
+    void Transform::setInterpolationEnabled(bool interpolate) {
+        if (isInterpolated_ == interpolate)
+            return;
+
+        isInterpolated_ = interpolate;
+        savePreviousState();
+        eventEmitter_.emit(transformPropertyChangeEvent, Property{"interpolationEnable", isInterpolated_});
+
+        // The object may have been rendered at an interpolated state, it must be rendered at its current state again
+        if (!isInterpolated_) {
+            eventEmitter_.emit(transformPropertyChangeEvent, Property{"position", position_});
+            eventEmitter_.emit(transformPropertyChangeEvent, Property{"rotation", rotation_});
+        }
+    }
+
+    bool Transform::isInterpolationEnabled() const {
+        return isInterpolated_;
+    }
+
+    Vector2f Transform::getInterpolatedPosition(float alpha) const {
+        if (!isInterpolated_)
+            return position_;
+
+        return prevPosition_ + (position_ - prevPosition_) * alpha;
+    }
+
+    float Transform::getInterpolatedRotation(float alpha) const {
+        if (!isInterpolated_)
+            return rotation_;
+
+        // Interpolate along the shortest arc
+        float delta = static_cast<float>(fmod(static_cast<double>(rotation_ - prevRotation_) + 540.0, 360.0)) - 180.0f;
+        float rotation = static_cast<float>(fmod(static_cast<double>(prevRotation_ + delta * alpha), 360.0));
+
+        return rotation < 0 ? rotation + 360.0f : rotation;
+    }
+
+    void Transform::savePreviousState() {
+        prevPosition_ = position_;
+        prevRotation_ = rotation_;
+    }
+
+    void Transform::setDeferredSyncEnabled(bool deferred) {
+        if (isDeferred_ == deferred)
+            return;
+
+        if (!deferred)
+            flushChanges();
+
+        isDeferred_ = deferred;
+    }
+
+    bool Transform::isDeferredSyncEnabled() const {
+        return isDeferred_;
+    }
+
+    bool Transform::isDirty() const {
+        return dirtyFlags_ != 0;
+    }
+
+    void Transform::markDirty(Uint8 flag) {
+        bool wasDirty = dirtyFlags_ != 0;
+        dirtyFlags_ |= flag;
+
+        if (!wasDirty)
+            eventEmitter_.emit(transformDirtyEvent);
+    }
+
+    void Transform::flushChanges() {
+        if (dirtyFlags_ == 0)
+            return;
+
+        // Reset first, a listener may modify the transform again
+        Uint8 dirtyFlags = dirtyFlags_;
+        dirtyFlags_ = 0;
+
+        if (dirtyFlags & TransformPositionDirty)
+            eventEmitter_.emit(transformPropertyChangeEvent, Property{"position", position_});
+
+        if (dirtyFlags & TransformRotationDirty)
+            eventEmitter_.emit(transformPropertyChangeEvent, Property{"rotation", rotation_});
+
+        if (dirtyFlags & TransformScaleDirty)
+            eventEmitter_.emit(transformPropertyChangeEvent, Property{"scale", scale_});
+
+        if (dirtyFlags & TransformOriginDirty)
+            eventEmitter_.emit(transformPropertyChangeEvent, Property{"origin", origin_});
+    }
+
+    int Transform::onDirty(const Callback<>& callback, bool oneTime) {
+        return utility::addEventListener(eventEmitter_, transformDirtyEvent, callback, oneTime);
+    }
+
     int Transform::onPropertyChange(const Callback<Property>& callback, bool oneTime) {
-        return utility::addEventListener(eventEmitter_, "propertyChange", callback, oneTime);
+        return utility::addEventListener(eventEmitter_, transformPropertyChangeEvent, callback, oneTime);
     }
 
     bool Transform::unsubscribe(int id) {
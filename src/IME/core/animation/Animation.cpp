@@ -30,6 +30,9 @@
 
 namespace ime {
     namespace {
+        // Events are looked up by precomputed keys
+        constexpr EventKey animationFrameSwitchEvent{"frameSwitch"};
+
         // If the frame rate or the duration of the animation is unspecified,
         // it is set to this value
         const auto defaultFrameRate = 24u;
@@ -365,7 +368,7 @@ namespace ime {
     }
 
     int Animation::onFrameSwitch(const Callback<AnimationFrame*>& callback, bool oneTime) {
-        return utility::addEventListener(eventEmitter_, "frameSwitch", callback, oneTime);
+        return utility::addEventListener(eventEmitter_, animationFrameSwitchEvent, callback, oneTime);
     }
 
     int Animation::onStart(const Callback<Animation*>& callback, bool oneTime) {
@@ -400,7 +403,7 @@ namespace ime {
         return utility::addEventListener(eventEmitter_, "complete", callback, oneTime);
     }
 
-    void Animation::emit(const std::string &event) {
+    void Animation::emit(const EventKey& event) {
         eventEmitter_.emit(event, this);
     }
 
@@ -410,7 +413,7 @@ namespace ime {
 
         currentFrameIndex_ = index;
         frames_[index].isCurrent_ = true;
-        eventEmitter_.emit("frameSwitch", &frames_[index]);
+        eventEmitter_.emit(animationFrameSwitchEvent, &frames_[index]);
     }
 
     void Animation::updateIndexes() {
@@ -30,6 +30,27 @@
 #include <memory>
 
 namespace ime {
+    namespace {
+        // Events are looked up by precomputed keys
+        constexpr EventKey animStartEvent{"animStart"};
+        constexpr EventKey animPlayEvent{"animPlay"};
+        constexpr EventKey animPauseEvent{"animPause"};
+        constexpr EventKey animResumeEvent{"animResume"};
+        constexpr EventKey animRestartEvent{"animRestart"};
+        constexpr EventKey animStopEvent{"animStop"};
+        constexpr EventKey animRepeatEvent{"animRepeat"};
+        constexpr EventKey animCompleteEvent{"animComplete"};
+        constexpr EventKey animSwitchEvent{"animSwitch"};
+        constexpr EventKey animationPlayEvent{"play"};
+        constexpr EventKey animationStartEvent{"start"};
+        constexpr EventKey animationPauseEvent{"pause"};
+        constexpr EventKey animationResumeEvent{"resume"};
+        constexpr EventKey animationStopEvent{"stop"};
+        constexpr EventKey animationCompleteEvent{"complete"};
+        constexpr EventKey animationRepeatEvent{"repeat"};
+        constexpr EventKey animationRestartEvent{"restart"};
+    }
+
     Animator::Animator() :
         currentFrameIndex_{0},
         timescale_{1.0f},
@@ -345,39 +366,39 @@ namespace ime {
     }
 
     int Animator::onAnimStart(const Callback<Animation*>& callback, bool oneTime) {
-        return utility::addEventListener(eventEmitter_, "animStart", callback, oneTime);
+        return utility::addEventListener(eventEmitter_, animStartEvent, callback, oneTime);
     }
 
     int Animator::onAnimPlay(const Callback<Animation *> &callback, bool oneTime) {
-        return utility::addEventListener(eventEmitter_, "animPlay", callback, oneTime);
+        return utility::addEventListener(eventEmitter_, animPlayEvent, callback, oneTime);
     }
 
     int Animator::onAnimPause(const Callback<Animation*>& callback, bool oneTime) {
-        return utility::addEventListener(eventEmitter_, "animPause", callback, oneTime);
+        return utility::addEventListener(eventEmitter_, animPauseEvent, callback, oneTime);
     }
 
     int Animator::onAnimResume(const Callback<Animation*>& callback, bool oneTime) {
-        return utility::addEventListener(eventEmitter_, "animResume", callback, oneTime);
+        return utility::addEventListener(eventEmitter_, animResumeEvent, callback, oneTime);
     }
 
     int Animator::onAnimRestart(const Callback<Animation*>& callback, bool oneTime) {
-        return utility::addEventListener(eventEmitter_, "animRestart", callback, oneTime);
+        return utility::addEventListener(eventEmitter_, animRestartEvent, callback, oneTime);
     }
 
     int Animator::onAnimStop(const Callback<Animation*>& callback, bool oneTime) {
-        return utility::addEventListener(eventEmitter_, "animStop", callback, oneTime);
+        return utility::addEventListener(eventEmitter_, animStopEvent, callback, oneTime);
     }
 
     int Animator::onAnimRepeat(const Callback<Animation*>& callback, bool oneTime) {
-        return utility::addEventListener(eventEmitter_, "animRepeat", callback, oneTime);
+        return utility::addEventListener(eventEmitter_, animRepeatEvent, callback, oneTime);
     }
 
     int Animator::onAnimComplete(const Callback<Animation*>& callback, bool oneTime) {
-        return utility::addEventListener(eventEmitter_, "animComplete", callback, oneTime);
+        return utility::addEventListener(eventEmitter_, animCompleteEvent, callback, oneTime);
     }
 
     int Animator::onAnimSwitch(const Callback<Animation*>& callback, bool oneTime) {
-        return utility::addEventListener(eventEmitter_, "animSwitch", callback, oneTime);
+        return utility::addEventListener(eventEmitter_, animSwitchEvent, callback, oneTime);
     }
 
     void Animator::update(Time deltaTime) {
@@ -409,39 +430,39 @@ namespace ime {
     void Animator::fireEvent(Animator::Event event, const Animation::Ptr& animation) {
         switch (event) {
             case Event::AnimationPlay:
-                animation->emit("play");
-                eventEmitter_.emit("animPlay", animation.get());
+                animation->emit(animationPlayEvent);
+                eventEmitter_.emit(animPlayEvent, animation.get());
                 break;
             case Event::AnimationStart:
-                animation->emit("start");
-                eventEmitter_.emit("animStart", animation.get());
+                animation->emit(animationStartEvent);
+                eventEmitter_.emit(animStartEvent, animation.get());
                 break;
             case Event::AnimationPause:
-                animation->emit("pause");
-                eventEmitter_.emit("animPause", animation.get());
+                animation->emit(animationPauseEvent);
+                eventEmitter_.emit(animPauseEvent, animation.get());
                 break;
             case Event::AnimationResume:
-                animation->emit("resume");
-                eventEmitter_.emit("animResume", animation.get());
+                animation->emit(animationResumeEvent);
+                eventEmitter_.emit(animResumeEvent, animation.get());
                 break;
             case Event::AnimationStop:
-                animation->emit("stop");
-                eventEmitter_.emit("animStop", animation.get());
+                animation->emit(animationStopEvent);
+                eventEmitter_.emit(animStopEvent, animation.get());
                 break;
             case Event::AnimationComplete:
-                animation->emit("complete");
-                eventEmitter_.emit("animComplete", animation.get());
+                animation->emit(animationCompleteEvent);
+                eventEmitter_.emit(animCompleteEvent, animation.get());
                 break;
             case Event::AnimationRepeat:
-                animation->emit("repeat");
-                eventEmitter_.emit("animRepeat", animation.get());
+                animation->emit(animationRepeatEvent);
+                eventEmitter_.emit(animRepeatEvent, animation.get());
                 break;
             case Event::AnimationRestart:
-                animation->emit("restart");
-                eventEmitter_.emit("animRestart", animation.get());
+                animation->emit(animationRestartEvent);
+                eventEmitter_.emit(animRestartEvent, animation.get());
                 break;
             case Event::AnimationSwitch:
-                eventEmitter_.emit("animSwitch", animation.get());
+                eventEmitter_.emit(animSwitchEvent, animation.get());
             default:
                 break;
         }
@@ -48,11 +48,11 @@ namespace ime::audio {
             isMuted_ = true;
             volumeBeforeMute_ = getVolume();
             setVolume(0.0f);
-            emitChange(Property{"mute", true});
+            emitChange("mute", true);
         } else if (!mute && isMuted_) {
             isMuted_ = false;
             setVolume(volumeBeforeMute_);
-            emitChange(Property{"mute", false});
+            emitChange("mute", false);
         }
     }
 
@@ -45,7 +45,7 @@ namespace ime::audio {
             if (sourceFilename_ != source) {
                 song_ = ResourceManager::getInstance()->getMusic(source);
                 sourceFilename_ = source;
-                parent_->emitChange(Property{"source", sourceFilename_});
+                parent_->emitChange("source", sourceFilename_);
             }
         }
 
@@ -58,7 +58,7 @@ namespace ime::audio {
                 if (parent_->isMuted())
                     parent_->setMute(false);
                 song_->setVolume(volume);
-                parent_->emitChange(Property{"volume", volume});
+                parent_->emitChange("volume", volume);
             }
         }
 
@@ -71,7 +71,7 @@ namespace ime::audio {
         void setPitch(float pitch) {
             if (song_ && pitch != getPitch()) {
                 song_->setPitch(pitch);
-                parent_->emitChange(Property{"pitch", pitch});
+                parent_->emitChange("pitch", pitch);
             }
         }
 
@@ -84,7 +84,7 @@ namespace ime::audio {
         void setLoop(bool isLooped) {
             if (song_ && song_->getLoop() != isLooped) {
                 song_->setLoop(isLooped);
-                parent_->emitChange(Property{"loop", isLooped});
+                parent_->emitChange("loop", isLooped);
             }
         }
 
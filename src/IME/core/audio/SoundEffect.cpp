@@ -44,7 +44,7 @@ namespace ime::audio {
             if (sfxName_ != filename) {
                 soundEffect_.setBuffer(ResourceManager::getInstance()->getSoundBuffer(filename));
                 sfxName_ = filename;
-                parent_->emitChange(Property{"source", sfxName_});
+                parent_->emitChange("source", sfxName_);
             }
         }
 
@@ -56,7 +56,7 @@ namespace ime::audio {
             if (volume != soundEffect_.getVolume()
                 && (volume >=0 && volume <= 100)) {
                 soundEffect_.setVolume(volume);
-                parent_->emitChange(Property{"volume", volume});
+                parent_->emitChange("volume", volume);
             }
         }
 
@@ -75,7 +75,7 @@ namespace ime::audio {
         void setLoop(bool isLooped) {
             if (soundEffect_.getLoop() != isLooped) {
                 soundEffect_.setLoop(isLooped);
-                parent_->emitChange(Property{"loop", isLooped});
+                parent_->emitChange("loop", isLooped);
             }
         }
 
@@ -27,6 +27,10 @@
 #include "IME/core/scene/SceneManager.h"
 #include "IME/core/resources/ResourceManager.h"
 #include "IME/graphics/RenderTarget.h"
+#include "IME/graphics/RenderSnapshot.h"
+#include "IME/core/engine/WorkerThread.h"
+#include "IME/core/event/EventQueue.h"
+#include "IME/core/event/EventStatsCollector.h"
 #include "IME/utility/Helpers.h"
 #include "IME/core/exceptions/Exceptions.h"
 
@@ -63,7 +67,13 @@ namespace ime {
         isInitialized_{false},
         isRunning_{false},
         isPaused_{false},
+        isHeadless_{false},
+        isRenderPipelined_{false},
+        isEventCoalescingEnabled_{false},
+        isReplaying_{false},
         fixedUpdateFPS_{60},
+        eventQueue_{std::make_unique<priv::EventQueue>()},
+        eventStatsCollector_{std::make_unique<priv::EventStatsCollector>()},
         sceneManager_{std::make_unique<priv::SceneManager>(this)},
         popCounter_{0}
     {}
@@ -74,8 +84,30 @@ namespace ime {
 
         processSettings();
         initResourceManager();
-        initRenderTarget();
-        gui_.setTarget(*privWindow_);
+        isHeadless_ = configs_.getPref("HEADLESS").getValue<bool>();
+
+        // A replay takes its input from the recording instead of a window
+        const auto replayFile = configs_.getPref("REPLAY_FILE").getValue<std::string>();
+        if (!replayFile.empty()) {
+            sessionPlayer_.open(replayFile);
+            isReplaying_ = true;
+            isHeadless_ = true;
+        }
+
+        initFramePacer();
+
+        if (!isHeadless_) {
+            initRenderTarget();
+            gui_.setTarget(*privWindow_);
+        }
+
+        isRenderPipelined_ = !isHeadless_ && configs_.getPref("PIPELINED_RENDERING").getValue<bool>();
+
+        if (isRenderPipelined_) {
+            simulationThread_ = std::make_unique<priv::WorkerThread>();
+            frontSnapshot_ = std::make_unique<priv::RenderSnapshot>();
+            backSnapshot_ = std::make_unique<priv::RenderSnapshot>();
+        }
 
         eventDispatcher_ = EventDispatcher::instance();
         isInitialized_ = true;
@@ -95,6 +127,10 @@ namespace ime {
         setDefaultValueIfNotSet(configs_, "FPS_LIMIT", PrefType::Int, 60, "The frames per second limit of the render window");
         setDefaultValueIfNotSet(configs_, "FULLSCREEN", PrefType::Bool, false, "Indicates whether or not the render window should be created in full screen mode");
         setDefaultValueIfNotSet(configs_, "V_SYNC", PrefType::Bool, false, "Indicates whether or not vertical synchronization should be enabled");
+        setDefaultValueIfNotSet(configs_, "FRAME_PACING", PrefType::String, std::string("Default"), "How frames are paced: Default, Precise, Smooth or PreciseSmooth");
+        setDefaultValueIfNotSet(configs_, "HEADLESS", PrefType::Bool, false, "Indicates whether or not the engine should run without a window");
+        setDefaultValueIfNotSet(configs_, "PIPELINED_RENDERING", PrefType::Bool, false, "Indicates whether or not the next frame should be updated while the current frame is rendered");
+        setDefaultValueIfNotSet(configs_, "REPLAY_FILE", PrefType::String, std::string(""), "A recorded session to play back headless instead of running interactively");
         setDefaultValueIfNotSet(configs_, "FONTS_DIR", PrefType::String, std::string(""), "The directory in which fonts can be found");
         setDefaultValueIfNotSet(configs_, "TEXTURES_DIR", PrefType::String, std::string(""), "The directory in which textures/images can be found");
         setDefaultValueIfNotSet(configs_, "SOUND_EFFECTS_DIR", PrefType::String, std::string(""), "The directory in which sound effects can be found");
@@ -146,7 +182,37 @@ namespace ime {
         resourceManager_->setPathFor(ResourceType::Music, configs_.getPref("MUSIC_DIR").getValue<std::string>());
     }
 
+    void Engine::initFramePacer() {
+        auto pacing = configs_.getPref("FRAME_PACING").getValue<std::string>();
+
+        if (pacing != "Default" && pacing != "Precise" && pacing != "Smooth" && pacing != "PreciseSmooth") {
+            IME_PRINT_WARNING("Unknown FRAME_PACING value '" + pacing + "', using 'Default' instead")
+            pacing = "Default";
+        }
+
+        // A headless engine is never frame rate limited
+        framePacer_.reset();
+        framePacer_.setLimiterEnabled(!isHeadless_ && (pacing == "Precise" || pacing == "PreciseSmooth"));
+        framePacer_.setSmoothingEnabled(pacing == "Smooth" || pacing == "PreciseSmooth");
+        window_->isPacedByEngine_ = framePacer_.isLimiterEnabled();
+    }
+
+    Time Engine::computeDeltaTime(Clock& gameClock) {
+        Time measuredTime = gameClock.restart();
+
+        if (isReplaying_)
+            return replayDeltaTime_;
+        else if (deltaTimeSource_)
+            return deltaTimeSource_();
+        else if (fixedDeltaTime_ != Time::Zero)
+            return fixedDeltaTime_;
+        else
+            return framePacer_.smooth(measuredTime);
+    }
+
     void Engine::processEvents() {
+        eventBatch_.clear();
+
         Event event;
         while (privWindow_->pollEvent(event)) {
             if (event.type == Event::Closed)
@@ -171,9 +237,30 @@ namespace ime {
             else if (event.type == Event::MouseLeft)
                 window_->emitMouseCursor(false);
 
-            gui_.handleEvent(event);
-            inputManager_.handleEvent(event);
-            sceneManager_->handleEvent(event);
+            eventBatch_.push(event);
+        }
+
+        if (eventBatch_.isEmpty())
+            return;
+
+        if (isEventCoalescingEnabled_)
+            eventBatch_.coalesce();
+
+        dispatchEvents();
+    }
+
+    void Engine::dispatchEvents() {
+        // The gui does not respond to joystick events and the input manager
+        // only responds to input device events, so they are skipped for the rest
+        for (const Event& polledEvent : eventBatch_) {
+            // A headless engine has no gui target
+            if (!isHeadless_ && !EventMasks::Joystick.contains(polledEvent.type))
+                gui_.handleEvent(polledEvent);
+
+            if (EventMasks::Input.contains(polledEvent.type))
+                inputManager_.handleEvent(polledEvent);
+
+            sceneManager_->handleEvent(polledEvent);
         }
     }
 
@@ -192,22 +279,76 @@ namespace ime {
         isRunning_ = true;
         Time deltaTime;
         Clock gameClock;
+
+        // Events posted by the threads of this engine are only dispatched by this engine
+        eventDispatcher_->bindQueue(*eventQueue_);
+        priv::setThreadEventStatsCollector(eventStatsCollector_.get());
+
+        if (simulationThread_) {
+            simulationThread_->dispatch([this] {
+                priv::setThreadEventQueue(eventQueue_.get());
+                priv::setThreadEventStatsCollector(eventStatsCollector_.get());
+            });
+
+            simulationThread_->wait();
+        }
+
         eventEmitter_.emit("start");
         sceneManager_->enterTopScene();
         eventEmitter_.emit("sceneActivate", sceneManager_->getActiveScene());
 
-        while (window_->isOpen() && isRunning_ && !sceneManager_->isEmpty()) {
+        // The first pipelined frame draws the initial state of the scene
+        if (isRenderPipelined_) {
+            captureRenderState();
+            std::swap(frontSnapshot_, backSnapshot_);
+        }
+
+        while ((isHeadless_ || window_->isOpen()) && isRunning_ && !sceneManager_->isEmpty()) {
+            // A replay ends when the recording runs out of frames
+            if (isReplaying_ && !sessionPlayer_.readFrame(replayDeltaTime_, eventBatch_))
+                break;
+
+            frameProfiler_.beginFrame();
             eventEmitter_.emit("frameStart");
-            deltaTime = gameClock.restart();
+            deltaTime = computeDeltaTime(gameClock);
             preUpdate(deltaTime);
-            processEvents();
-            update(deltaTime);
-            clear();
-            render();
-            display();
+            frameProfiler_.endPhase(FramePhase::PreUpdate);
+
+            if (isReplaying_)
+                dispatchEvents();
+            else if (!isHeadless_)
+                processEvents();
+
+            if (sessionRecorder_.isRecording())
+                sessionRecorder_.recordFrame(deltaTime, eventBatch_);
+
+            frameProfiler_.endPhase(FramePhase::ProcessEvents);
+
+            if (isRenderPipelined_)
+                updateAndRenderPipelined(deltaTime);
+            else {
+                update(deltaTime);
+                frameProfiler_.endPhase(FramePhase::Update);
+
+                if (!isHeadless_) {
+                    clear();
+                    frameProfiler_.endPhase(FramePhase::Clear);
+                    render();
+                    frameProfiler_.endPhase(FramePhase::Render);
+                    display();
+                    frameProfiler_.endPhase(FramePhase::Display);
+                }
+            }
+
             postFrameUpdate();
             elapsedTime_ += deltaTime;
             eventEmitter_.emit("frameEnd");
+            frameProfiler_.endPhase(FramePhase::PostFrameUpdate);
+            frameProfiler_.endFrame();
+
+#ifdef IME_ENABLE_EVENT_STATS
+            eventStats_ = eventStatsCollector_->collect();
+#endif
         }
 
         shutdown();
@@ -229,25 +370,81 @@ namespace ime {
             return;
 
         const Time frameTime = seconds( 1.0f / static_cast<float>(fixedUpdateFPS_));
-        static Time accumulator = Time::Zero;
 
         // Fixed update
         if (deltaTime.asSeconds() > 0.25f)
             deltaTime = seconds(0.25f);
 
-        accumulator += deltaTime;
+        fixedUpdateAccumulator_ += deltaTime;
+        unsigned int fixedUpdateCount = 0;
 
-        while (accumulator >= frameTime) {
+        Clock fixedUpdateClock;
+        while (fixedUpdateAccumulator_ >= frameTime) {
             sceneManager_->fixedUpdate(frameTime);
-            accumulator -= frameTime;
+            fixedUpdateAccumulator_ -= frameTime;
+            fixedUpdateCount++;
         }
 
-        // Normal update
-        inputManager_.update();
+        frameProfiler_.setFixedUpdateCount(fixedUpdateCount);
+
+        // When pipelined, this function runs on the simulation thread, which must not touch the profiler's phase marks
+        if (isRenderPipelined_)
+            simulationFixedUpdateTime_ = fixedUpdateClock.getElapsedTime();
+        else
+            frameProfiler_.endPhase(FramePhase::FixedUpdate);
+
+        // Normal update (Input is polled on the window thread when pipelined)
+        if (!isHeadless_ && !isRenderPipelined_)
+            inputManager_.update();
         timerManager_.update(deltaTime);
         sceneManager_->update(deltaTime);
     }
 
+    void Engine::updateAndRenderPipelined(Time deltaTime) {
+        // Input is polled on the window thread, so it must be updated before the simulation thread reads it
+        if (!isPaused_) {
+            inputManager_.update();
+            sceneManager_->updateInput();
+        }
+
+        simulationFixedUpdateTime_ = simulationUpdateTime_ = Time::Zero;
+
+        simulationThread_->dispatch([this, deltaTime] {
+            Clock simulationClock;
+            update(deltaTime);
+            captureRenderState();
+            simulationUpdateTime_ = simulationClock.getElapsedTime() - simulationFixedUpdateTime_;
+        });
+
+        // Draw the previous frame while the next one is being updated
+        clear();
+        frameProfiler_.endPhase(FramePhase::Clear);
+        privWindow_->draw(*frontSnapshot_);
+        frontSnapshot_->clear();
+
+        // The time spent waiting for the simulation thread is not part of any phase
+        frameProfiler_.pause();
+        simulationThread_->wait();
+        frameProfiler_.resume();
+        frameProfiler_.addPhaseTime(FramePhase::FixedUpdate, simulationFixedUpdateTime_);
+        frameProfiler_.addPhaseTime(FramePhase::Update, simulationUpdateTime_);
+        std::swap(frontSnapshot_, backSnapshot_);
+
+        // The gui cannot be recorded, so it is drawn once the update is complete
+        sceneManager_->renderGui();
+        gui_.draw();
+        frameProfiler_.endPhase(FramePhase::Render);
+        display();
+        frameProfiler_.endPhase(FramePhase::Display);
+    }
+
+    void Engine::captureRenderState() {
+        backSnapshot_->clear();
+        privWindow_->beginRecording(*backSnapshot_);
+        sceneManager_->render(*privWindow_);
+        privWindow_->endRecording();
+    }
+
     void Engine::clear() {
         privWindow_->clear(window_->getClearColour());
     }
@@ -259,6 +456,11 @@ namespace ime {
 
     void Engine::display() {
         privWindow_->display();
+
+        if (framePacer_.isLimiterEnabled()) {
+            framePacer_.setFrameRateLimit(window_->getFrameRateLimit());
+            framePacer_.waitForNextFrame();
+        }
     }
 
     void Engine::pushScene(Scene::Ptr scene) {
@@ -343,6 +545,8 @@ namespace ime {
     }
 
     void Engine::postFrameUpdate() {
+        eventDispatcher_->dispatchQueuedEvents();
+        jobSystem_.executeMainThreadJobs();
         audioManager_.removePlayedAudio();
         timerManager_.preUpdate();
 
@@ -373,15 +577,27 @@ namespace ime {
     }
 
     void Engine::shutdown() {
+        jobSystem_.waitForAll();
+        jobSystem_.executeMainThreadJobs();
         eventEmitter_.emit("shutdown");
         eventEmitter_.clear();
         audioManager_.stopAll();
         audioManager_.removePlayedAudio();
         isInitialized_ = false;
         isRunning_ = false;
+        isHeadless_ = false;
+        isRenderPipelined_ = false;
+        isReplaying_ = false;
+        sessionRecorder_.stop();
+        sessionPlayer_.close();
+        eventBatch_.clear();
+        simulationThread_.reset();
+        frontSnapshot_.reset();
+        backSnapshot_.reset();
         popCounter_ = 0;
         isSettingsLoadedFromFile_ = false;
         elapsedTime_ = Time::Zero;
+        fixedUpdateAccumulator_ = Time::Zero;
         gameTitle_.clear();
         settingFile_.clear();
         configs_.clear();
@@ -392,6 +608,9 @@ namespace ime {
         diskDataSaver_.clear();
         resourceManager_.reset();
         inputManager_ = input::InputManager();
+        eventDispatcher_->unbindQueue(*eventQueue_);
+        if (priv::getThreadEventStatsCollector() == eventStatsCollector_.get())
+            priv::setThreadEventStatsCollector(nullptr);
         eventDispatcher_.reset();
 
         while (!scenesPendingPush_.empty())
@@ -428,6 +647,86 @@ namespace ime {
         return fixedUpdateFPS_;
     }
 
+    bool Engine::isHeadless() const {
+        return isHeadless_;
+    }
+
+    bool Engine::isRenderPipelined() const {
+        return isRenderPipelined_;
+    }
+
+    void Engine::setEventCoalescingEnabled(bool enable) {
+        isEventCoalescingEnabled_ = enable;
+    }
+
+    bool Engine::isEventCoalescingEnabled() const {
+        return isEventCoalescingEnabled_;
+    }
+
+    void Engine::startRecording(const std::string &filename) {
+        sessionRecorder_.start(filename);
+    }
+
+    void Engine::stopRecording() {
+        sessionRecorder_.stop();
+    }
+
+    bool Engine::isRecording() const {
+        return sessionRecorder_.isRecording();
+    }
+
+    bool Engine::isReplaying() const {
+        return isReplaying_;
+    }
+
+    void Engine::setFixedDeltaTime(const Time& deltaTime) {
+        fixedDeltaTime_ = deltaTime;
+    }
+
+    Time Engine::getFixedDeltaTime() const {
+        return fixedDeltaTime_;
+    }
+
+    void Engine::setDeltaTimeSource(const std::function<Time()>& source) {
+        deltaTimeSource_ = source;
+    }
+
+    FrameProfiler &Engine::getFrameProfiler() {
+        return frameProfiler_;
+    }
+
+    const FrameProfiler &Engine::getFrameProfiler() const {
+        return frameProfiler_;
+    }
+
+    FramePacer &Engine::getFramePacer() {
+        return framePacer_;
+    }
+
+    const FramePacer &Engine::getFramePacer() const {
+        return framePacer_;
+    }
+
+    JobSystem &Engine::getJobSystem() {
+        return jobSystem_;
+    }
+
+    const JobSystem &Engine::getJobSystem() const {
+        return jobSystem_;
+    }
+
+    FrameStats Engine::getFrameStats() const {
+        return frameProfiler_.computeStats();
+    }
+
+    const EventStats& Engine::getEventStats() const {
+        return eventStats_;
+    }
+
+    float Engine::getFixedUpdateAlpha() const {
+        return fixedUpdateAccumulator_ / seconds(1.0f / static_cast<float>(fixedUpdateFPS_));
+    }
+
     Time Engine::getElapsedTime() const {
         return elapsedTime_;
     }
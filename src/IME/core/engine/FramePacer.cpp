@@ -0,0 +1,138 @@
+////////////////////////////////////////////////////////////////////////////////
+// IME - Infinite Motion Engine
+//
+// Copyright (c) 2020-2022 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "IME/core/engine/FramePacer.h"
+#include <algorithm>
+#include <thread>
+
+namespace ime {
+    FramePacer::FramePacer() :
+        isLimiterEnabled_{false},
+        isSmoothingEnabled_{false},
+        frameRateLimit_{60},
+        spinThreshold_{milliseconds(2)},
+        isScheduled_{false},
+        smoothingWindow_{5},
+        nextSample_{0}
+    {}
+
+    void FramePacer::setLimiterEnabled(bool enable) {
+        if (isLimiterEnabled_ != enable) {
+            isLimiterEnabled_ = enable;
+            isScheduled_ = false;
+        }
+    }
+
+    bool FramePacer::isLimiterEnabled() const {
+        return isLimiterEnabled_;
+    }
+
+    void FramePacer::setFrameRateLimit(unsigned int limit) {
+        if (frameRateLimit_ != limit) {
+            frameRateLimit_ = limit;
+            isScheduled_ = false;
+        }
+    }
+
+    unsigned int FramePacer::getFrameRateLimit() const {
+        return frameRateLimit_;
+    }
+
+    void FramePacer::setSpinThreshold(const Time &threshold) {
+        spinThreshold_ = threshold;
+    }
+
+    Time FramePacer::getSpinThreshold() const {
+        return spinThreshold_;
+    }
+
+    void FramePacer::setSmoothingEnabled(bool enable) {
+        isSmoothingEnabled_ = enable;
+    }
+
+    bool FramePacer::isSmoothingEnabled() const {
+        return isSmoothingEnabled_;
+    }
+
+    void FramePacer::setSmoothingWindow(std::size_t frameCount) {
+        smoothingWindow_ = std::max<std::size_t>(frameCount, 1);
+        samples_.clear();
+        nextSample_ = 0;
+    }
+
+    std::size_t FramePacer::getSmoothingWindow() const {
+        return smoothingWindow_;
+    }
+
+    Time FramePacer::smooth(const Time &deltaTime) {
+        if (!isSmoothingEnabled_)
+            return deltaTime;
+
+        if (samples_.size() < smoothingWindow_)
+            samples_.push_back(deltaTime);
+        else
+            samples_[nextSample_] = deltaTime;
+
+        nextSample_ = (nextSample_ + 1) % smoothingWindow_;
+
+        sortedSamples_.assign(samples_.begin(), samples_.end());
+        auto median = sortedSamples_.begin() + static_cast<std::ptrdiff_t>(sortedSamples_.size() / 2);
+        std::nth_element(sortedSamples_.begin(), median, sortedSamples_.end());
+        return *median;
+    }
+
+    void FramePacer::waitForNextFrame() {
+        if (!isLimiterEnabled_ || frameRateLimit_ == 0)
+            return;
+
+        const auto period = std::chrono::duration_cast<Clock::duration>(
+            std::chrono::duration<double>(1.0 / static_cast<double>(frameRateLimit_)));
+
+        Clock::time_point now = Clock::now();
+
+        // First frame or the frame ran late, start a new schedule from now
+        if (!isScheduled_ || now >= nextFrame_) {
+            nextFrame_ = now + period;
+            isScheduled_ = true;
+            return;
+        }
+
+        // Sleep through most of the remaining time, then spin for the rest
+        const auto spinThreshold = std::chrono::microseconds(spinThreshold_.asMicroseconds());
+
+        if (nextFrame_ - now > spinThreshold)
+            std::this_thread::sleep_for(nextFrame_ - now - spinThreshold);
+
+        while (Clock::now() < nextFrame_)
+            std::this_thread::yield();
+
+        nextFrame_ += period;
+    }
+
+    void FramePacer::reset() {
+        isScheduled_ = false;
+        samples_.clear();
+        nextSample_ = 0;
+    }
+}
@@ -0,0 +1,205 @@
+////////////////////////////////////////////////////////////////////////////////
+// IME - Infinite Motion Engine
+//
+// Copyright (c) 2020-2022 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "IME/core/engine/FrameProfiler.h"
+#include <algorithm>
+#include <cmath>
+
+namespace ime {
+    namespace {
+        Time toTime(std::chrono::steady_clock::duration duration) {
+            return nanoseconds(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+        }
+
+        PhaseStats computePhaseStats(std::vector<Time>& samples) {
+            PhaseStats stats;
+            if (samples.empty())
+                return stats;
+
+            std::sort(samples.begin(), samples.end());
+
+            // Nearest-rank percentile
+            auto percentile = [&samples](float p) {
+                auto rank = static_cast<std::size_t>(std::ceil(p * static_cast<float>(samples.size())));
+                return samples[std::clamp<std::size_t>(rank, 1, samples.size()) - 1];
+            };
+
+            Time total;
+            for (const auto& sample : samples)
+                total += sample;
+
+            stats.min = samples.front();
+            stats.max = samples.back();
+            stats.average = total / static_cast<Int64>(samples.size());
+            stats.p95 = percentile(0.95f);
+            stats.p99 = percentile(0.99f);
+            return stats;
+        }
+    }
+
+    const PhaseStats &FrameStats::getPhase(FramePhase phase) const {
+        return phases[static_cast<std::size_t>(phase)];
+    }
+
+    FrameProfiler::FrameProfiler(std::size_t capacity) :
+        capacity_{std::max<std::size_t>(capacity, 1)},
+        next_{0},
+        isEnabled_{true}
+    {
+        records_.reserve(capacity_);
+    }
+
+    void FrameProfiler::setEnabled(bool enable) {
+        isEnabled_ = enable;
+    }
+
+    bool FrameProfiler::isEnabled() const {
+        return isEnabled_;
+    }
+
+    void FrameProfiler::setCapacity(std::size_t capacity) {
+        capacity = std::max<std::size_t>(capacity, 1);
+
+        if (capacity_ == capacity)
+            return;
+
+        // Unwrap the ring buffer so that records are ordered from oldest to newest
+        std::rotate(records_.begin(), records_.begin() + static_cast<std::ptrdiff_t>(next_ % std::max<std::size_t>(records_.size(), 1)), records_.end());
+
+        if (records_.size() > capacity)
+            records_.erase(records_.begin(), records_.begin() + static_cast<std::ptrdiff_t>(records_.size() - capacity));
+
+        capacity_ = capacity;
+        next_ = records_.size() % capacity_;
+        records_.reserve(capacity_);
+    }
+
+    std::size_t FrameProfiler::getCapacity() const {
+        return capacity_;
+    }
+
+    std::size_t FrameProfiler::getRecordCount() const {
+        return records_.size();
+    }
+
+    const FrameProfiler::FrameRecord &FrameProfiler::getLastFrame() const {
+        IME_ASSERT(!records_.empty(), "There are no recorded frames")
+        return records_[(next_ + records_.size() - 1) % records_.size()];
+    }
+
+    FrameStats FrameProfiler::computeStats() const {
+        FrameStats stats;
+        stats.frameCount = records_.size();
+
+        if (records_.empty())
+            return stats;
+
+        std::vector<Time> samples;
+        samples.reserve(records_.size());
+
+        for (const auto& record : records_)
+            samples.push_back(record.frameTime);
+
+        stats.frame = computePhaseStats(samples);
+
+        for (std::size_t phase = 0; phase < stats.phases.size(); ++phase) {
+            samples.clear();
+
+            for (const auto& record : records_)
+                samples.push_back(record.phases[phase]);
+
+            stats.phases[phase] = computePhaseStats(samples);
+        }
+
+        unsigned int totalFixedUpdates = 0;
+        for (const auto& record : records_) {
+            totalFixedUpdates += record.fixedUpdates;
+            stats.maxFixedUpdates = std::max(stats.maxFixedUpdates, record.fixedUpdates);
+        }
+
+        stats.averageFixedUpdates = static_cast<float>(totalFixedUpdates) / static_cast<float>(records_.size());
+        return stats;
+    }
+
+    void FrameProfiler::clear() {
+        records_.clear();
+        next_ = 0;
+    }
+
+    void FrameProfiler::beginFrame() {
+        if (!isEnabled_)
+            return;
+
+        current_ = FrameRecord{};
+        frameStart_ = lastMark_ = std::chrono::steady_clock::now();
+    }
+
+    void FrameProfiler::endPhase(FramePhase phase) {
+        if (!isEnabled_)
+            return;
+
+        TimePoint now = std::chrono::steady_clock::now();
+        current_.phases[static_cast<std::size_t>(phase)] += toTime(now - lastMark_);
+        lastMark_ = now;
+    }
+
+    void FrameProfiler::addPhaseTime(FramePhase phase, Time time) {
+        if (!isEnabled_)
+            return;
+
+        current_.phases[static_cast<std::size_t>(phase)] += time;
+    }
+
+    void FrameProfiler::pause() {
+        if (!isEnabled_)
+            return;
+
+        pauseStart_ = std::chrono::steady_clock::now();
+    }
+
+    void FrameProfiler::resume() {
+        if (!isEnabled_)
+            return;
+
+        lastMark_ += std::chrono::steady_clock::now() - pauseStart_;
+    }
+
+    void FrameProfiler::setFixedUpdateCount(unsigned int count) {
+        current_.fixedUpdates = count;
+    }
+
+    void FrameProfiler::endFrame() {
+        if (!isEnabled_)
+            return;
+
+        current_.frameTime = toTime(std::chrono::steady_clock::now() - frameStart_);
+
+        if (records_.size() < capacity_)
+            records_.push_back(current_);
+        else
+            records_[next_] = current_;
+
+        next_ = (next_ + 1) % capacity_;
+    }
+}
@@ -0,0 +1,485 @@
+////////////////////////////////////////////////////////////////////////////////
+// IME - Infinite Motion Engine
+//
+// Copyright (c) 2020-2022 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "IME/core/engine/JobSystem.h"
+#include "IME/core/event/EventQueue.h"
+#include "IME/core/event/EventStatsCollector.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ime {
+    namespace priv {
+        struct JobState {
+            JobSystem::Job function;                        //!< The function executed by the job
+            std::shared_ptr<JobState> parent;               //!< The job that waits for this job to complete
+            std::atomic<int> unfinishedJobs{1};             //!< The job itself and its incomplete children
+            std::atomic<bool> isRun{false};                 //!< A flag indicating whether or not the job was run
+            std::mutex mutex;                               //!< Synchronizes access to the exception
+            std::exception_ptr exception;                   //!< First exception thrown by the job or its children
+            std::atomic<std::size_t>* activeJobs = nullptr; //!< The unexecuted jobs of the job system that ran the job
+            EventQueue* eventQueue = nullptr;               //!< Receives the events posted by the job
+            EventStatsCollector* eventStats = nullptr;      //!< Records the emits of the job
+
+            void setException(const std::exception_ptr& ptr) {
+                std::scoped_lock lock(mutex);
+                if (!exception)
+                    exception = ptr;
+            }
+        };
+    }
+
+    namespace {
+        unsigned int computeJobThreadCount(unsigned int requested) {
+            if (requested != 0)
+                return requested;
+
+            // Leave a hardware thread for the main thread (0 means it's unknown)
+            unsigned int hardwareThreads = std::thread::hardware_concurrency();
+            return hardwareThreads > 1 ? hardwareThreads - 1 : 1;
+        }
+
+        /**
+         * @brief Worker threads that execute the jobs of one or more job systems
+         */
+        class WorkerPool {
+        public:
+            using JobPtr = std::shared_ptr<priv::JobState>;
+
+            explicit WorkerPool(unsigned int threadCount) :
+                threadCount_{threadCount},
+                pendingJobs_{0},
+                waiterCount_{0},
+                nextQueue_{0},
+                isStopping_{false}
+            {
+                for (auto i = 0u; i < threadCount_; i++)
+                    queues_.push_back(std::make_unique<Queue>());
+            }
+
+            /**
+             * @brief Get the pool shared by the job systems that do not
+             *        request a thread count
+             *
+             * Every engine owns a job system, without sharing, each engine
+             * would start a worker thread per hardware thread
+             */
+            static std::shared_ptr<WorkerPool> getShared() {
+                static std::mutex sharedMutex;
+                static std::weak_ptr<WorkerPool> shared;
+                std::scoped_lock lock(sharedMutex);
+
+                if (auto pool = shared.lock())
+                    return pool;
+
+                auto pool = std::make_shared<WorkerPool>(computeJobThreadCount(0));
+                shared = pool;
+                return pool;
+            }
+
+            unsigned int getThreadCount() const {
+                return threadCount_;
+            }
+
+            void submit(JobPtr job) {
+                std::call_once(startFlag_, [this] {
+                    for (auto i = 0u; i < threadCount_; i++)
+                        threads_.emplace_back(&WorkerPool::work, this, i);
+                });
+
+                // Jobs created by a worker go to its own queue, such that related
+                // jobs tend to be executed by the same thread
+                std::size_t index = isWorkerThread() ? workerIndex : nextQueue_++ % queues_.size();
+
+                // Counted before it is published, such that take() never decrements past zero
+                {
+                    std::scoped_lock lock(sleepMutex_);
+                    pendingJobs_++;
+                }
+
+                {
+                    std::scoped_lock lock(queues_[index]->mutex);
+                    queues_[index]->jobs.push_back(std::move(job));
+                }
+
+                sleepCv_.notify_one();
+            }
+
+            /**
+             * @brief Execute pending jobs until a condition is met
+             * @param isDone The condition
+             *
+             * The calling thread sleeps when there is nothing to execute.
+             * It is woken up when a job is submitted or completed
+             */
+            template <typename Predicate>
+            void executeUntil(const Predicate& isDone) {
+                while (!isDone()) {
+                    if (JobPtr job = take()) {
+                        execute(job);
+                        continue;
+                    }
+
+                    waiterCount_++;
+
+                    {
+                        std::unique_lock lock(sleepMutex_);
+                        sleepCv_.wait(lock, [this, &isDone] { return pendingJobs_ > 0 || isDone(); });
+                    }
+
+                    waiterCount_--;
+                }
+            }
+
+            ~WorkerPool() {
+                {
+                    std::scoped_lock lock(sleepMutex_);
+                    isStopping_ = true;
+                }
+
+                sleepCv_.notify_all();
+
+                for (auto& thread : threads_)
+                    thread.join();
+            }
+
+        private:
+            struct Queue {
+                std::mutex mutex;        //!< Synchronizes access to the queue
+                std::deque<JobPtr> jobs; //!< Jobs waiting to be executed
+            };
+
+            bool isWorkerThread() const {
+                return workerPool == this;
+            }
+
+            JobPtr take() {
+                std::size_t ownIndex = isWorkerThread() ? workerIndex : 0;
+
+                for (std::size_t i = 0; i < queues_.size(); i++) {
+                    std::size_t index = (ownIndex + i) % queues_.size();
+                    Queue& queue = *queues_[index];
+                    std::scoped_lock lock(queue.mutex);
+
+                    if (queue.jobs.empty())
+                        continue;
+
+                    JobPtr job;
+
+                    // Own queue is used as a stack (newest first), other queues are
+                    // stolen from the opposite end to reduce contention with their owner
+                    if (i == 0 && isWorkerThread()) {
+                        job = std::move(queue.jobs.back());
+                        queue.jobs.pop_back();
+                    } else {
+                        job = std::move(queue.jobs.front());
+                        queue.jobs.pop_front();
+                    }
+
+                    pendingJobs_--;
+                    return job;
+                }
+
+                return nullptr;
+            }
+
+            void execute(const JobPtr& job) {
+                // Events posted and emitted by the job belong to the engine that created it
+                priv::EventQueue* eventQueue = priv::getThreadEventQueue();
+                priv::EventStatsCollector* eventStats = priv::getThreadEventStatsCollector();
+                priv::setThreadEventQueue(job->eventQueue);
+                priv::setThreadEventStatsCollector(job->eventStats);
+
+                try {
+                    job->function();
+                } catch (...) {
+                    job->setException(std::current_exception());
+                }
+
+                priv::setThreadEventQueue(eventQueue);
+                priv::setThreadEventStatsCollector(eventStats);
+
+                job->function = nullptr;
+                bool isWaitedFor = finish(job);
+
+                if (job->activeJobs->fetch_sub(1) == 1)
+                    isWaitedFor = true;
+
+                if (isWaitedFor)
+                    notifyWaiters();
+            }
+
+            /**
+             * @brief Mark a job as executed
+             * @param job The executed job
+             * @return True if the job or one of its ancestors completed
+             */
+            static bool finish(const JobPtr& job) {
+                if (job->unfinishedJobs.fetch_sub(1) != 1)
+                    return false;
+
+                if (job->parent) {
+                    if (job->exception)
+                        job->parent->setException(job->exception);
+
+                    finish(job->parent);
+                }
+
+                return true;
+            }
+
+            void notifyWaiters() {
+                // Nobody can start waiting in between, the waiters are counted before they check their condition
+                if (waiterCount_ > 0) {
+                    std::unique_lock lock(sleepMutex_);
+                    lock.unlock();
+                    sleepCv_.notify_all();
+                }
+            }
+
+            void work(std::size_t index) {
+                workerPool = this;
+                workerIndex = index;
+
+                while (true) {
+                    if (JobPtr job = take()) {
+                        execute(job);
+                        continue;
+                    }
+
+                    std::unique_lock lock(sleepMutex_);
+                    sleepCv_.wait(lock, [this] { return pendingJobs_ > 0 || isStopping_; });
+
+                    if (isStopping_ && pendingJobs_ == 0)
+                        return;
+                }
+            }
+
+        private:
+            unsigned int threadCount_;                   //!< The number of worker threads
+            std::vector<std::unique_ptr<Queue>> queues_; //!< A job queue for each worker thread
+            std::vector<std::thread> threads_;           //!< Worker threads
+            std::once_flag startFlag_;                   //!< Starts the worker threads once
+            std::atomic<std::size_t> pendingJobs_;       //!< The number of jobs waiting in the queues
+            std::atomic<std::size_t> waiterCount_;       //!< The number of threads sleeping in executeUntil()
+            std::atomic<std::size_t> nextQueue_;         //!< The queue the next job submitted by a non-worker thread goes to
+            std::mutex sleepMutex_;                      //!< Synchronizes idle threads
+            std::condition_variable sleepCv_;            //!< Wakes up idle threads
+            bool isStopping_;                            //!< A flag indicating whether or not the worker threads must exit
+
+            static thread_local const WorkerPool* workerPool; //!< The pool the current thread works for
+            static thread_local std::size_t workerIndex;      //!< The queue of the current worker thread
+        };
+
+        thread_local const WorkerPool* WorkerPool::workerPool = nullptr;
+        thread_local std::size_t WorkerPool::workerIndex = 0;
+    }
+
+    bool JobHandle::isValid() const {
+        return state_ != nullptr;
+    }
+
+    bool JobHandle::isComplete() const {
+        return !state_ || state_->unfinishedJobs.load(std::memory_order_acquire) == 0;
+    }
+
+    JobHandle::JobHandle(std::shared_ptr<priv::JobState> state) :
+        state_{std::move(state)}
+    {}
+
+    //////////////////////////////////////////////////////////////////////////
+    // JobSystem implementation
+    //////////////////////////////////////////////////////////////////////////
+    class JobSystem::JobSystemImpl {
+    public:
+        using JobPtr = std::shared_ptr<priv::JobState>;
+
+        explicit JobSystemImpl(unsigned int threadCount) :
+            pool_{threadCount == 0 ? WorkerPool::getShared() : std::make_shared<WorkerPool>(threadCount)},
+            activeJobs_{0}
+        {}
+
+        unsigned int getThreadCount() const {
+            return pool_->getThreadCount();
+        }
+
+        void submit(JobPtr job) {
+            job->activeJobs = &activeJobs_;
+            activeJobs_++;
+            pool_->submit(std::move(job));
+        }
+
+        void wait(const JobPtr& state) {
+            pool_->executeUntil([&state] {
+                return state->unfinishedJobs.load() == 0;
+            });
+
+            std::scoped_lock lock(state->mutex);
+            if (state->exception)
+                std::rethrow_exception(state->exception);
+        }
+
+        void waitForAll() {
+            pool_->executeUntil([this] {
+                return activeJobs_.load() == 0;
+            });
+        }
+
+        void runOnMainThread(Job job) {
+            std::scoped_lock lock(mainThreadMutex_);
+            mainThreadJobs_.push_back(std::move(job));
+        }
+
+        std::size_t executeMainThreadJobs() {
+            std::vector<Job> jobs;
+
+            {
+                std::scoped_lock lock(mainThreadMutex_);
+                std::swap(jobs, mainThreadJobs_);
+            }
+
+            for (auto& job : jobs)
+                job();
+
+            return jobs.size();
+        }
+
+        ~JobSystemImpl() {
+            // The pool may outlive this job system, the jobs refer to its counter
+            waitForAll();
+        }
+
+    private:
+        std::shared_ptr<WorkerPool> pool_;     //!< Executes the jobs
+        std::atomic<std::size_t> activeJobs_;  //!< The number of jobs that were run but have not been executed
+        std::mutex mainThreadMutex_;           //!< Synchronizes access to the main thread jobs
+        std::vector<Job> mainThreadJobs_;      //!< Jobs to be executed on the main thread
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // JobSystem class delegation
+    //////////////////////////////////////////////////////////////////////////
+
+    JobSystem::JobSystem(unsigned int threadCount) :
+        pimpl_{std::make_unique<JobSystemImpl>(threadCount)}
+    {}
+
+    unsigned int JobSystem::getThreadCount() const {
+        return pimpl_->getThreadCount();
+    }
+
+    JobHandle JobSystem::createJob(Job job) {
+        IME_ASSERT(job, "A job cannot be a nullptr")
+        auto state = std::make_shared<priv::JobState>();
+        state->function = std::move(job);
+        state->eventQueue = priv::getThreadEventQueue();
+        state->eventStats = priv::getThreadEventStatsCollector();
+        return JobHandle{std::move(state)};
+    }
+
+    JobHandle JobSystem::createChildJob(const JobHandle &parent, Job job) {
+        IME_ASSERT(parent.isValid(), "The parent of a child job must be a valid job")
+        IME_ASSERT(!parent.isComplete(), "A child job cannot be attached to a job that is already complete")
+
+        JobHandle child = createJob(std::move(job));
+        child.state_->parent = parent.state_;
+        parent.state_->unfinishedJobs.fetch_add(1, std::memory_order_relaxed);
+        return child;
+    }
+
+    void JobSystem::run(const JobHandle &handle) {
+        IME_ASSERT(handle.isValid(), "Cannot run an invalid job")
+        if (handle.state_->isRun.exchange(true)) {
+            IME_PRINT_WARNING("A job can only be run once, the request to rerun the job was ignored")
+            return;
+        }
+
+        pimpl_->submit(handle.state_);
+    }
+
+    JobHandle JobSystem::schedule(Job job) {
+        JobHandle handle = createJob(std::move(job));
+        run(handle);
+        return handle;
+    }
+
+    void JobSystem::wait(const JobHandle &handle) {
+        if (handle.isValid())
+            pimpl_->wait(handle.state_);
+    }
+
+    void JobSystem::waitForAll() {
+        pimpl_->waitForAll();
+    }
+
+    void JobSystem::parallelFor(std::size_t begin, std::size_t end,
+        const std::function<void(std::size_t)>& function, std::size_t grainSize)
+    {
+        if (begin >= end)
+            return;
+
+        std::size_t count = end - begin;
+
+        if (grainSize == 0)
+            grainSize = std::max<std::size_t>(1, count / (getThreadCount() * 4));
+
+        // Not worth distributing
+        if (count <= grainSize) {
+            for (auto i = begin; i < end; i++)
+                function(i);
+
+            return;
+        }
+
+        JobHandle parent = createJob([] {});
+
+        for (auto first = begin; first < end; first += std::min(grainSize, end - first)) {
+            std::size_t last = first + std::min(grainSize, end - first);
+
+            run(createChildJob(parent, [&function, first, last] {
+                for (auto i = first; i < last; i++)
+                    function(i);
+            }));
+        }
+
+        run(parent);
+        wait(parent);
+    }
+
+    void JobSystem::runOnMainThread(Job job) {
+        IME_ASSERT(job, "A job cannot be a nullptr")
+        pimpl_->runOnMainThread(std::move(job));
+    }
+
+    std::size_t JobSystem::executeMainThreadJobs() {
+        return pimpl_->executeMainThreadJobs();
+    }
+
+    JobSystem::~JobSystem() = default;
+}
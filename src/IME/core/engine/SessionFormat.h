@@ -0,0 +1,301 @@
+////////////////////////////////////////////////////////////////////////////////
+// IME - Infinite Motion Engine
+//
+// Copyright (c) 2020-2022 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef IME_SESSIONFORMAT_H
+#define IME_SESSIONFORMAT_H
+
+#include "IME/Config.h"
+#include "IME/core/event/Event.h"
+#include <cstring>
+#include <istream>
+#include <ostream>
+
+namespace ime::priv {
+    /**
+     * @brief Encoding of the recorded session files
+     *
+     * A session file starts with a 4 byte magic number and a version byte,
+     * followed by one record per frame. A frame record is the frame delta
+     * time in nanoseconds and the number of events polled in the frame,
+     * followed by the events. Integers are stored as variable length
+     * quantities (7 bits per byte, least significant group first) and
+     * floats as their 4 byte little endian bit pattern, therefore files
+     * are portable between platforms and compilers
+     */
+    namespace SessionFormat {
+        constexpr char Magic[4] = {'I', 'M', 'E', 'S'}; //!< Identifies a session file
+        constexpr Uint8 Version = 1;                    //!< Current version of the format
+
+        /**
+         * @brief Write an unsigned integer
+         * @param stream The stream to write to
+         * @param value The value to be written
+         */
+        inline void writeUnsigned(std::ostream& stream, Uint64 value) {
+            do {
+                auto byte = static_cast<Uint8>(value & 0x7Fu);
+                value >>= 7;
+                if (value != 0)
+                    byte |= 0x80u;
+
+                stream.put(static_cast<char>(byte));
+            } while (value != 0);
+        }
+
+        /**
+         * @brief Read an unsigned integer
+         * @param stream The stream to read from
+         * @param value Receives the read value
+         * @return True if the value was read, otherwise false
+         */
+        inline bool readUnsigned(std::istream& stream, Uint64& value) {
+            value = 0;
+            for (unsigned int shift = 0; shift < 64; shift += 7) {
+                int byte = stream.get();
+                if (byte == std::char_traits<char>::eof())
+                    return false;
+
+                value |= static_cast<Uint64>(byte & 0x7F) << shift;
+                if ((byte & 0x80) == 0)
+                    return true;
+            }
+
+            return false;
+        }
+
+        /**
+         * @brief Write a signed integer
+         * @param stream The stream to write to
+         * @param value The value to be written
+         *
+         * The value is zigzag encoded such that small negative values
+         * are as compact as small positive values
+         */
+        inline void writeSigned(std::ostream& stream, Int64 value) {
+            writeUnsigned(stream, (static_cast<Uint64>(value) << 1) ^ static_cast<Uint64>(value >> 63));
+        }
+
+        /**
+         * @brief Read a signed integer
+         * @param stream The stream to read from
+         * @param value Receives the read value
+         * @return True if the value was read, otherwise false
+         */
+        inline bool readSigned(std::istream& stream, Int64& value) {
+            Uint64 encoded;
+            if (!readUnsigned(stream, encoded))
+                return false;
+
+            value = static_cast<Int64>(encoded >> 1) ^ -static_cast<Int64>(encoded & 1u);
+            return true;
+        }
+
+        /**
+         * @brief Write a float
+         * @param stream The stream to write to
+         * @param value The value to be written
+         */
+        inline void writeFloat(std::ostream& stream, float value) {
+            Uint32 bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            for (int i = 0; i < 4; ++i)
+                stream.put(static_cast<char>((bits >> (8 * i)) & 0xFFu));
+        }
+
+        /**
+         * @brief Read a float
+         * @param stream The stream to read from
+         * @param value Receives the read value
+         * @return True if the value was read, otherwise false
+         */
+        inline bool readFloat(std::istream& stream, float& value) {
+            Uint32 bits = 0;
+            for (int i = 0; i < 4; ++i) {
+                int byte = stream.get();
+                if (byte == std::char_traits<char>::eof())
+                    return false;
+
+                bits |= static_cast<Uint32>(byte) << (8 * i);
+            }
+
+            std::memcpy(&value, &bits, sizeof(value));
+            return true;
+        }
+
+        /**
+         * @brief Write a system event
+         * @param stream The stream to write to
+         * @param event The event to be written
+         *
+         * Only the data that belongs to the type of the event is written
+         */
+        inline void writeEvent(std::ostream& stream, const Event& event) {
+            writeSigned(stream, event.type);
+
+            switch (event.type) {
+                case Event::Resized:
+                    writeUnsigned(stream, event.size.width);
+                    writeUnsigned(stream, event.size.height);
+                    break;
+                case Event::TextEntered:
+                    writeUnsigned(stream, event.text.unicode);
+                    break;
+                case Event::KeyPressed:
+                case Event::KeyReleased:
+                    writeSigned(stream, static_cast<Int64>(event.key.code));
+                    writeUnsigned(stream, static_cast<Uint64>(event.key.alt) | static_cast<Uint64>(event.key.control) << 1
+                        | static_cast<Uint64>(event.key.shift) << 2 | static_cast<Uint64>(event.key.system) << 3);
+                    break;
+                case Event::MouseWheelScrolled:
+                    writeSigned(stream, static_cast<Int64>(event.mouseWheelScroll.wheel));
+                    writeFloat(stream, event.mouseWheelScroll.delta);
+                    writeSigned(stream, event.mouseWheelScroll.x);
+                    writeSigned(stream, event.mouseWheelScroll.y);
+                    break;
+                case Event::MouseButtonPressed:
+                case Event::MouseButtonReleased:
+                    writeSigned(stream, static_cast<Int64>(event.mouseButton.button));
+                    writeSigned(stream, event.mouseButton.x);
+                    writeSigned(stream, event.mouseButton.y);
+                    break;
+                case Event::MouseMoved:
+                    writeSigned(stream, event.mouseMove.x);
+                    writeSigned(stream, event.mouseMove.y);
+                    break;
+                case Event::JoystickButtonPressed:
+                case Event::JoystickButtonReleased:
+                    writeUnsigned(stream, event.joystickButton.joystickId);
+                    writeUnsigned(stream, event.joystickButton.button);
+                    break;
+                case Event::JoystickMoved:
+                    writeUnsigned(stream, event.joystickMove.joystickId);
+                    writeSigned(stream, static_cast<Int64>(event.joystickMove.axis));
+                    writeFloat(stream, event.joystickMove.position);
+                    break;
+                case Event::JoystickConnected:
+                case Event::JoystickDisconnected:
+                    writeUnsigned(stream, event.joystickConnect.joystickId);
+                    break;
+                default:
+                    break;
+            }
+        }
+
+        /**
+         * @brief Read a system event
+         * @param stream The stream to read from
+         * @param event Receives the read event
+         * @return True if the event was read, otherwise false
+         */
+        inline bool readEvent(std::istream& stream, Event& event) {
+            Int64 type, a, b, c;
+            Uint64 u, v;
+            float f;
+
+            if (!readSigned(stream, type) || type < Event::Unknown || type > Event::JoystickDisconnected)
+                return false;
+
+            event.type = static_cast<Event::Type>(type);
+
+            switch (event.type) {
+                case Event::Resized:
+                    if (!readUnsigned(stream, u) || !readUnsigned(stream, v))
+                        return false;
+
+                    event.size.width = static_cast<unsigned int>(u);
+                    event.size.height = static_cast<unsigned int>(v);
+                    return true;
+                case Event::TextEntered:
+                    if (!readUnsigned(stream, u))
+                        return false;
+
+                    event.text.unicode = static_cast<unsigned int>(u);
+                    return true;
+                case Event::KeyPressed:
+                case Event::KeyReleased:
+                    if (!readSigned(stream, a) || !readUnsigned(stream, u))
+                        return false;
+
+                    event.key.code = static_cast<input::Keyboard::Key>(a);
+                    event.key.alt = (u & 1u) != 0;
+                    event.key.control = (u & 2u) != 0;
+                    event.key.shift = (u & 4u) != 0;
+                    event.key.system = (u & 8u) != 0;
+                    return true;
+                case Event::MouseWheelScrolled:
+                    if (!readSigned(stream, a) || !readFloat(stream, f) || !readSigned(stream, b) || !readSigned(stream, c))
+                        return false;
+
+                    event.mouseWheelScroll.wheel = static_cast<input::Mouse::Wheel>(a);
+                    event.mouseWheelScroll.delta = f;
+                    event.mouseWheelScroll.x = static_cast<int>(b);
+                    event.mouseWheelScroll.y = static_cast<int>(c);
+                    return true;
+                case Event::MouseButtonPressed:
+                case Event::MouseButtonReleased:
+                    if (!readSigned(stream, a) || !readSigned(stream, b) || !readSigned(stream, c))
+                        return false;
+
+                    event.mouseButton.button = static_cast<input::Mouse::Button>(a);
+                    event.mouseButton.x = static_cast<int>(b);
+                    event.mouseButton.y = static_cast<int>(c);
+                    return true;
+                case Event::MouseMoved:
+                    if (!readSigned(stream, a) || !readSigned(stream, b))
+                        return false;
+
+                    event.mouseMove.x = static_cast<int>(a);
+                    event.mouseMove.y = static_cast<int>(b);
+                    return true;
+                case Event::JoystickButtonPressed:
+                case Event::JoystickButtonReleased:
+                    if (!readUnsigned(stream, u) || !readUnsigned(stream, v))
+                        return false;
+
+                    event.joystickButton.joystickId = static_cast<unsigned int>(u);
+                    event.joystickButton.button = static_cast<unsigned int>(v);
+                    return true;
+                case Event::JoystickMoved:
+                    if (!readUnsigned(stream, u) || !readSigned(stream, a) || !readFloat(stream, f))
+                        return false;
+
+                    event.joystickMove.joystickId = static_cast<unsigned int>(u);
+                    event.joystickMove.axis = static_cast<input::Joystick::Axis>(a);
+                    event.joystickMove.position = f;
+                    return true;
+                case Event::JoystickConnected:
+                case Event::JoystickDisconnected:
+                    if (!readUnsigned(stream, u))
+                        return false;
+
+                    event.joystickConnect.joystickId = static_cast<unsigned int>(u);
+                    return true;
+                default:
+                    return true;
+            }
+        }
+    }
+}
+
+#endif // IME_SESSIONFORMAT_H
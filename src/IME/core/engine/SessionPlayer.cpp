@@ -0,0 +1,98 @@
+////////////////////////////////////////////////////////////////////////////////
+// IME - Infinite Motion Engine
+//
+// Copyright (c) 2020-2022 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "IME/core/engine/SessionPlayer.h"
+#include "IME/core/exceptions/Exceptions.h"
+#include "IME/core/engine/SessionFormat.h"
+#include <algorithm>
+
+namespace ime {
+    SessionPlayer::SessionPlayer() :
+        frameCount_{0}
+    {}
+
+    void SessionPlayer::open(const std::string &filename) {
+        close();
+
+        file_.open(filename, std::ios::binary);
+        if (!file_)
+            throw FileNotFoundException(R"(cannot find file ")" + filename + R"(")");
+
+        char magic[sizeof(priv::SessionFormat::Magic)];
+        file_.read(magic, sizeof(magic));
+        int version = file_.get();
+
+        if (!file_ || !std::equal(std::begin(magic), std::end(magic), std::begin(priv::SessionFormat::Magic))) {
+            close();
+            throw InvalidParseException(R"(")" + filename + R"(" is not an IME session recording)");
+        }
+
+        if (version != priv::SessionFormat::Version) {
+            close();
+            throw InvalidParseException(R"(")" + filename + R"(" was recorded with an unsupported session format version)");
+        }
+    }
+
+    bool SessionPlayer::readFrame(Time &deltaTime, EventBatch &events) {
+        events.clear();
+
+        if (!file_.is_open())
+            return false;
+
+        Int64 deltaNs;
+        Uint64 eventCount;
+        if (!priv::SessionFormat::readSigned(file_, deltaNs) || !priv::SessionFormat::readUnsigned(file_, eventCount))
+            return false;
+
+        for (Uint64 i = 0; i < eventCount; ++i) {
+            Event event;
+            if (!priv::SessionFormat::readEvent(file_, event)) {
+                events.clear();
+                return false;
+            }
+
+            events.push(event);
+        }
+
+        deltaTime = nanoseconds(deltaNs);
+        frameCount_++;
+        return true;
+    }
+
+    void SessionPlayer::close() {
+        if (file_.is_open())
+            file_.close();
+
+        file_.clear();
+        frameCount_ = 0;
+    }
+
+    bool SessionPlayer::isOpen() const {
+        return file_.is_open();
+    }
+
+    unsigned int SessionPlayer::getFrameCount() const {
+        return frameCount_;
+    }
+}
@@ -0,0 +1,77 @@
+////////////////////////////////////////////////////////////////////////////////
+// IME - Infinite Motion Engine
+//
+// Copyright (c) 2020-2022 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "IME/core/engine/SessionRecorder.h"
+#include "IME/core/exceptions/Exceptions.h"
+#include "IME/core/engine/SessionFormat.h"
+
+namespace ime {
+    SessionRecorder::SessionRecorder() :
+        frameCount_{0}
+    {}
+
+    void SessionRecorder::start(const std::string &filename) {
+        stop();
+
+        file_.open(filename, std::ios::binary | std::ios::trunc);
+        if (!file_)
+            throw FileNotFoundException(R"(cannot open ")" + filename + R"(" for recording)");
+
+        file_.write(priv::SessionFormat::Magic, sizeof(priv::SessionFormat::Magic));
+        file_.put(static_cast<char>(priv::SessionFormat::Version));
+    }
+
+    void SessionRecorder::recordFrame(Time deltaTime, const EventBatch &events) {
+        if (!file_.is_open())
+            return;
+
+        priv::SessionFormat::writeSigned(file_, deltaTime.asNanoseconds());
+        priv::SessionFormat::writeUnsigned(file_, events.getCount());
+
+        for (const Event& event : events)
+            priv::SessionFormat::writeEvent(file_, event);
+
+        frameCount_++;
+    }
+
+    void SessionRecorder::stop() {
+        if (file_.is_open())
+            file_.close();
+
+        file_.clear();
+        frameCount_ = 0;
+    }
+
+    bool SessionRecorder::isRecording() const {
+        return file_.is_open();
+    }
+
+    unsigned int SessionRecorder::getFrameCount() const {
+        return frameCount_;
+    }
+
+    SessionRecorder::~SessionRecorder() {
+        stop();
+    }
+}
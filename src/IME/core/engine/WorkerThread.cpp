@@ -0,0 +1,98 @@
+////////////////////////////////////////////////////////////////////////////////
+// IME - Infinite Motion Engine
+//
+// Copyright (c) 2020-2022 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "IME/core/engine/WorkerThread.h"
+#include <utility>
+
+namespace ime::priv {
+    WorkerThread::WorkerThread() :
+        hasTask_{false},
+        isStopping_{false}
+    {}
+
+    void WorkerThread::dispatch(std::function<void()> task) {
+        std::unique_lock lock(mutex_);
+        cv_.wait(lock, [this] { return !hasTask_; });
+
+        task_ = std::move(task);
+        hasTask_ = true;
+
+        if (!thread_.joinable())
+            thread_ = std::thread(&WorkerThread::run, this);
+
+        lock.unlock();
+        cv_.notify_all();
+    }
+
+    void WorkerThread::wait() {
+        std::unique_lock lock(mutex_);
+        cv_.wait(lock, [this] { return !hasTask_; });
+
+        if (exception_)
+            std::rethrow_exception(std::exchange(exception_, nullptr));
+    }
+
+    bool WorkerThread::isBusy() const {
+        std::scoped_lock lock(mutex_);
+        return hasTask_;
+    }
+
+    void WorkerThread::run() {
+        std::unique_lock lock(mutex_);
+
+        while (true) {
+            cv_.wait(lock, [this] { return hasTask_ || isStopping_; });
+
+            if (!hasTask_ && isStopping_)
+                return;
+
+            auto task = std::move(task_);
+            lock.unlock();
+
+            try {
+                task();
+            } catch (...) {
+                lock.lock();
+                exception_ = std::current_exception();
+                lock.unlock();
+            }
+
+            lock.lock();
+            hasTask_ = false;
+            cv_.notify_all();
+        }
+    }
+
+    WorkerThread::~WorkerThread() {
+        {
+            std::scoped_lock lock(mutex_);
+            isStopping_ = true;
+        }
+
+        cv_.notify_all();
+
+        if (thread_.joinable())
+            thread_.join();
+    }
+}
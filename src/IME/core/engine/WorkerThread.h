@@ -0,0 +1,107 @@
+////////////////////////////////////////////////////////////////////////////////
+// IME - Infinite Motion Engine
+//
+// Copyright (c) 2020-2022 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef IME_WORKERTHREAD_H
+#define IME_WORKERTHREAD_H
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace ime::priv {
+    /**
+     * @brief A thread that executes one task at a time on behalf of
+     *        another thread
+     *
+     * The thread is started when the first task is dispatched and it is
+     * kept alive until the worker is destroyed, such that dispatching a
+     * task every frame does not create a new thread every frame
+     */
+    class WorkerThread {
+    public:
+        /**
+         * @brief Default constructor
+         */
+        WorkerThread();
+
+        /**
+         * @brief Copy constructor
+         */
+        WorkerThread(const WorkerThread&) = delete;
+
+        /**
+         * @brief Copy assignment operator
+         */
+        WorkerThread& operator=(const WorkerThread&) = delete;
+
+        /**
+         * @brief Execute a task on the worker thread
+         * @param task The task to be executed
+         *
+         * If the worker is busy with the previous task, this function
+         * blocks until the previous task is complete
+         *
+         * @see wait
+         */
+        void dispatch(std::function<void()> task);
+
+        /**
+         * @brief Block until the dispatched task is complete
+         * @throws Any exception thrown by the dispatched task
+         */
+        void wait();
+
+        /**
+         * @brief Check if the worker is executing a task
+         * @return True if the worker is executing a task, otherwise false
+         */
+        bool isBusy() const;
+
+        /**
+         * @brief Destructor
+         *
+         * Waits for the dispatched task to complete and stops the thread
+         */
+        ~WorkerThread();
+
+    private:
+        /**
+         * @brief Execute dispatched tasks until the worker is stopped
+         */
+        void run();
+
+    private:
+        std::thread thread_;               //!< The worker thread
+        mutable std::mutex mutex_;         //!< Synchronizes access to the task
+        std::condition_variable cv_;       //!< Signals task dispatch and completion
+        std::function<void()> task_;       //!< The task to be executed
+        bool hasTask_;                     //!< A flag indicating whether or not a task is pending or running
+        bool isStopping_;                  //!< A flag indicating whether or not the thread must exit
+        std::exception_ptr exception_;     //!< Exception thrown by the last task
+    };
+}
+
+#endif // IME_WORKERTHREAD_H
@@ -0,0 +1,93 @@
+////////////////////////////////////////////////////////////////////////////////
+// IME - Infinite Motion Engine
+//
+// Copyright (c) 2020-2022 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "IME/core/event/EventBatch.h"
+
+namespace ime {
+    namespace {
+        // Checks if 'next' makes 'previous' redundant
+        bool isSupersededBy(const Event& previous, const Event& next) {
+            if (previous.type != next.type)
+                return false;
+
+            if (previous.type == Event::MouseMoved)
+                return true;
+
+            if (previous.type == Event::JoystickMoved) {
+                return previous.joystickMove.joystickId == next.joystickMove.joystickId
+                    && previous.joystickMove.axis == next.joystickMove.axis;
+            }
+
+            return false;
+        }
+    }
+
+    void EventBatch::push(const Event &event) {
+        events_.push_back(event);
+        types_.add(event.type);
+    }
+
+    std::size_t EventBatch::coalesce() {
+        if (!types_.contains(Event::MouseMoved) && !types_.contains(Event::JoystickMoved))
+            return 0;
+
+        // Keep an event only if the event that follows it does not supersede it
+        std::size_t kept = 0;
+        for (std::size_t i = 0; i < events_.size(); ++i) {
+            if (i + 1 < events_.size() && isSupersededBy(events_[i], events_[i + 1]))
+                continue;
+
+            events_[kept++] = events_[i];
+        }
+
+        std::size_t removed = events_.size() - kept;
+        events_.resize(kept);
+        return removed;
+    }
+
+    EventMask EventBatch::getTypes() const {
+        return types_;
+    }
+
+    std::size_t EventBatch::getCount() const {
+        return events_.size();
+    }
+
+    bool EventBatch::isEmpty() const {
+        return events_.empty();
+    }
+
+    void EventBatch::clear() {
+        events_.clear();
+        types_ = EventMask{};
+    }
+
+    EventBatch::ConstIterator EventBatch::begin() const {
+        return events_.cbegin();
+    }
+
+    EventBatch::ConstIterator EventBatch::end() const {
+        return events_.cend();
+    }
+}
@@ -23,8 +23,85 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "IME/core/event/EventDispatcher.h"
+#include "IME/core/event/EventQueue.h"
 
 namespace ime {
+    namespace {
+        thread_local priv::EventQueue* threadEventQueue = nullptr; //!< The queue of the engine the current thread belongs to
+    }
+
+    namespace priv {
+        void setThreadEventQueue(EventQueue* queue) {
+            threadEventQueue = queue;
+        }
+
+        EventQueue* getThreadEventQueue() {
+            return threadEventQueue;
+        }
+    }
+
+    EventDispatcher::EventDispatcher() :
+        queue_{std::make_unique<priv::EventQueue>()},
+        unboundEventsQueue_{nullptr},
+        queueBudget_{0}
+    {}
+
+    std::size_t EventDispatcher::dispatchQueuedEvents() {
+        std::size_t budget = queueBudget_.load(std::memory_order_relaxed);
+        priv::EventQueue* ownQueue = priv::getThreadEventQueue();
+        std::size_t dispatched = 0;
+
+        if (ownQueue)
+            dispatched = ownQueue->dispatch(eventEmitter_, budget);
+
+        // Events of threads that do not belong to an engine are dispatched by a single engine
+        if (unboundEventsQueue_.load(std::memory_order_acquire) == ownQueue && (budget == 0 || dispatched < budget))
+            dispatched += queue_->dispatch(eventEmitter_, budget == 0 ? 0 : budget - dispatched);
+
+#ifdef IME_ENABLE_EVENT_STATS
+        priv::recordQueuedEventsDispatched(dispatched);
+#endif
+
+        return dispatched;
+    }
+
+    void EventDispatcher::setQueuedEventBudget(std::size_t budget) {
+        queueBudget_.store(budget, std::memory_order_relaxed);
+    }
+
+    std::size_t EventDispatcher::getQueuedEventBudget() const {
+        return queueBudget_.load(std::memory_order_relaxed);
+    }
+
+    void EventDispatcher::enqueue(const std::string& event,
+        std::function<void(EventEmitter&, const std::string&)> emit, bool isCoalesced)
+    {
+        auto queuedEvent = std::make_unique<priv::QueuedEvent>();
+        queuedEvent->name = event;
+        queuedEvent->emit = std::move(emit);
+        queuedEvent->isCoalesced = isCoalesced;
+
+        if (priv::EventQueue* ownQueue = priv::getThreadEventQueue(); ownQueue)
+            ownQueue->push(std::move(queuedEvent));
+        else
+            queue_->push(std::move(queuedEvent));
+    }
+
+    void EventDispatcher::bindQueue(priv::EventQueue& queue) {
+        priv::setThreadEventQueue(&queue);
+
+        priv::EventQueue* expected = nullptr;
+        unboundEventsQueue_.compare_exchange_strong(expected, &queue, std::memory_order_acq_rel);
+    }
+
+    void EventDispatcher::unbindQueue(priv::EventQueue& queue) {
+        if (priv::getThreadEventQueue() == &queue)
+            priv::setThreadEventQueue(nullptr);
+
+        priv::EventQueue* expected = &queue;
+        unboundEventsQueue_.compare_exchange_strong(expected, nullptr, std::memory_order_acq_rel);
+    }
+
     bool EventDispatcher::removeEventListener(const std::string &event, int id) {
         return eventEmitter_.removeEventListener(event, id);
     }
@@ -36,4 +113,6 @@ namespace ime {
             return result;
         return (instance_ = EventDispatcher::Ptr(new EventDispatcher())).lock();
     }
+
+    EventDispatcher::~EventDispatcher() = default;
 }
\ No newline at end of file
@@ -24,99 +24,220 @@
 
 #include "IME/core/event/EventEmitter.h"
 #include <algorithm>
+#include <memory>
 
 namespace ime {
-    unsigned int EventEmitter::idCounter_{0};
+    std::atomic<unsigned int> EventEmitter::idCounter_{0};
 
     EventEmitter::EventEmitter() :
-        isActive_{true}
+        EventEmitter(ThreadingPolicy::MultiThreaded)
     {}
 
-    EventEmitter::EventEmitter(const EventEmitter &other) {
-        std::scoped_lock lock(other.mutex_);
-        auto temp{other.eventList_};
-        std::swap(eventList_, temp);
-        isActive_ = other.isActive_;
+    EventEmitter::EventEmitter(ThreadingPolicy policy) :
+        storage_{nullptr},
+        isActive_{true},
+        threadingPolicy_{policy}
+    {}
+
+    EventEmitter::EventEmitter(const EventEmitter &other) :
+        storage_{nullptr},
+        isActive_{other.isActive_},
+        threadingPolicy_{other.threadingPolicy_}
+    {
+        if (Storage* source = other.getStorage(); source) {
+            auto lock = other.lock(*source);
+            copyListeners(*source, getOrCreateStorage());
+        }
     }
 
     EventEmitter &EventEmitter::operator=(const EventEmitter &rhs) {
         if (this != &rhs) {
-            std::scoped_lock lock(mutex_, rhs.mutex_);
-            eventList_ = rhs.eventList_;
+            // Safe while rhs is emitting, the copy gets the listeners rhs has after the emission
+            EventEmitter temp{rhs};
+            Storage* source = temp.getStorage();
+            Storage* storage = source ? &getOrCreateStorage() : getStorage();
+
+            if (storage) {
+                auto lock = this->lock(*storage);
+                IME_ASSERT(storage->emitDepth == 0, "An event emitter cannot be assigned to while it is emitting an event")
+                storage->eventList.clear();
+
+                if (source)
+                    std::swap(storage->eventList, source->eventList);
+
+                rebuildListenerIndex(*storage);
+            }
+
             isActive_ = rhs.isActive_;
         }
 
         return *this;
     }
 
-    EventEmitter::EventEmitter(EventEmitter&& other) noexcept {
-        std::scoped_lock lock(other.mutex_);
-        std::swap(eventList_, other.eventList_);
-        isActive_ = other.isActive_;
-    }
+    EventEmitter::EventEmitter(EventEmitter&& other) noexcept :
+        storage_{other.storage_.exchange(nullptr)},
+        isActive_{other.isActive_},
+        threadingPolicy_{other.threadingPolicy_}
+    {}
 
     EventEmitter &EventEmitter::operator=(EventEmitter&& rhs) noexcept {
         if (this != &rhs) {
-            std::scoped_lock lock(mutex_, rhs.mutex_);
-            eventList_ = std::move(rhs.eventList_);
+            Storage* storage = getStorage();
+
+            if (!storage)
+                storage_.store(rhs.storage_.exchange(nullptr), std::memory_order_release);
+            else if (Storage* source = rhs.getStorage(); source) {
+                std::scoped_lock lock(storage->mutex, source->mutex);
+                IME_ASSERT(storage->emitDepth == 0, "An event emitter cannot be assigned to while it is emitting an event")
+
+                if (source->emitDepth > 0) {
+                    // The emission in progress iterates the listeners of rhs, so they are taken over instead of being moved
+                    storage->eventList.clear();
+                    storage->listenerIndex.clear();
+                    storage_.store(source, std::memory_order_release);
+                    rhs.storage_.store(storage, std::memory_order_release);
+                } else {
+                    storage->eventList = std::move(source->eventList);
+                    storage->listenerIndex = std::move(source->listenerIndex);
+                    source->eventList.clear();
+                    source->listenerIndex.clear();
+                }
+            } else {
+                auto lock = this->lock(*storage);
+                IME_ASSERT(storage->emitDepth == 0, "An event emitter cannot be assigned to while it is emitting an event")
+                storage->eventList.clear();
+                storage->listenerIndex.clear();
+            }
+
             isActive_ = rhs.isActive_;
         }
 
         return *this;
     }
 
-    bool EventEmitter::removeEventListener(const std::string &event, int id) {
-        std::scoped_lock lock(mutex_);
-        if (hasEvent(event)) {
-            if (auto [found, index] = hasListener(event, id); found) {
-                eventList_.at(event).erase(eventList_.at(event).begin() + index);
-                return true;
-            }
-        }
+    bool EventEmitter::removeEventListener(const EventKey& event, int id) {
+        Storage* storage = getStorage();
+        if (!storage)
+            return false;
+
+        auto lock = this->lock(*storage);
+        if (Listeners* listeners = findListeners(*storage, event); listeners)
+            return removeListener(*storage, *listeners, id);
+
         return false;
     }
 
     bool EventEmitter::removeEventListener(int id) {
-        std::scoped_lock lock(mutex_);
+        Storage* storage = getStorage();
+        if (!storage)
+            return false;
 
-        return std::any_of(eventList_.begin(), eventList_.end(), [=] (auto& pair) {
-            return removeEventListener(pair.first, id);
-        });
-    }
+        auto lock = this->lock(*storage);
+        if (auto found = storage->listenerIndex.find(id); found != storage->listenerIndex.end())
+            return removeListener(*storage, *found->second, id);
 
-    bool EventEmitter::removeAllEventListeners(const std::string &event) {
-        std::scoped_lock lock(mutex_);
-        if (hasEvent(event)) {
-            eventList_.at(event).clear();
-            return true;
-        }
         return false;
     }
 
+    bool EventEmitter::removeAllEventListeners(const EventKey& event) {
+        Storage* storage = getStorage();
+        if (!storage)
+            return false;
+
+        auto lock = this->lock(*storage);
+        Listeners* listeners = findListeners(*storage, event);
+        if (!listeners)
+            return false;
+
+        for (const Listener& listener : *listeners)
+            storage->listenerIndex.erase(listener.id_);
+
+        if (storage->emitDepth > 0) {
+            for (Listener& listener : *listeners) {
+                if (!listener.isRemoved_)
+                    markRemoved(*storage, *listeners, listener);
+            }
+
+            auto& pendingListeners = storage->pendingListeners;
+            pendingListeners.erase(std::remove_if(pendingListeners.begin(), pendingListeners.end(), [storage, listeners](const PendingListener& pendingListener) {
+                if (pendingListener.listeners != listeners)
+                    return false;
+
+                storage->listenerIndex.erase(pendingListener.listener.id_);
+                return true;
+            }), pendingListeners.end());
+        } else
+            listeners->clear();
+
+        return true;
+    }
+
     void EventEmitter::clear() {
-        eventList_.clear();
+        Storage* storage = getStorage();
+        if (!storage)
+            return;
+
+        auto lock = this->lock(*storage);
+
+        if (storage->emitDepth > 0) {
+            for (auto& pair : storage->eventList)
+                removeAllEventListeners(pair.second.name);
+        } else {
+            storage->eventList.clear();
+            storage->listenerIndex.clear();
+        }
     }
 
-    std::size_t EventEmitter::getEventListenerCount(const std::string& event) const {
-        std::scoped_lock lock(mutex_);
-        if (hasEvent(event))
-            return eventList_.at(event).size();
-        return 0;
+    std::size_t EventEmitter::getEventListenerCount(const EventKey& event) const {
+        Storage* storage = getStorage();
+        if (!storage)
+            return 0;
+
+        auto lock = this->lock(*storage);
+        const Listeners* listeners = findListeners(*storage, event);
+        if (!listeners)
+            return 0;
+
+        if (storage->emitDepth == 0)
+            return listeners->size();
+
+        auto count = static_cast<std::size_t>(std::count_if(listeners->begin(), listeners->end(), [](const Listener& listener) {
+            return !listener.isRemoved_;
+        }));
+
+        const auto& pendingListeners = storage->pendingListeners;
+        count += static_cast<std::size_t>(std::count_if(pendingListeners.begin(), pendingListeners.end(), [=](const PendingListener& pendingListener) {
+            return pendingListener.listeners == listeners;
+        }));
+
+        return count;
     }
 
     std::size_t EventEmitter::getEventsCount() const {
-        std::scoped_lock lock(mutex_);
-        return eventList_.size();
+        Storage* storage = getStorage();
+        if (!storage)
+            return 0;
+
+        auto lock = this->lock(*storage);
+        return storage->eventList.size();
     }
 
-    bool EventEmitter::hasEvent(const std::string &event) const {
-        std::scoped_lock lock(mutex_);
-        return eventList_.find(event) != eventList_.end();
+    bool EventEmitter::hasEvent(const EventKey& event) const {
+        Storage* storage = getStorage();
+        if (!storage)
+            return false;
+
+        auto lock = this->lock(*storage);
+        return findListeners(*storage, event) != nullptr;
     }
 
-    bool EventEmitter::suspendEventListener(const std::string &event, int id, bool suspend) {
-        std::scoped_lock lock(mutex_);
-        IListener* listener = getListener(event, id);
+    bool EventEmitter::suspendEventListener(const EventKey& event, int id, bool suspend) {
+        Storage* storage = getStorage();
+        if (!storage)
+            return false;
+
+        auto lock = this->lock(*storage);
+        Listener* listener = findListener(*storage, findListeners(*storage, event), id);
 
         if (listener) {
             listener->isSuspended_ = suspend;
@@ -127,16 +248,28 @@ namespace ime {
     }
 
     bool EventEmitter::suspendEventListener(int id, bool suspend) {
-        std::scoped_lock lock(mutex_);
+        Storage* storage = getStorage();
+        if (!storage)
+            return false;
 
-        return std::any_of(eventList_.begin(), eventList_.end(), [=] (auto& pair) {
-            return suspendEventListener(pair.first, id, suspend);
-        });
+        auto lock = this->lock(*storage);
+        Listener* listener = findListener(*storage, id);
+
+        if (listener) {
+            listener->isSuspended_ = suspend;
+            return true;
+        }
+
+        return false;
     }
 
-    bool EventEmitter::isEventListenerSuspended(const std::string& event, int id) const {
-        std::scoped_lock lock(mutex_);
-        const IListener* listener = getListener(event, id);
+    bool EventEmitter::isEventListenerSuspended(const EventKey& event, int id) const {
+        Storage* storage = getStorage();
+        if (!storage)
+            return false;
+
+        auto lock = this->lock(*storage);
+        const Listener* listener = findListener(std::as_const(*storage), findListeners(std::as_const(*storage), event), id);
 
         if (listener)
             return listener->isSuspended_;
@@ -145,22 +278,36 @@ namespace ime {
     }
 
     bool EventEmitter::isEventListenerSuspended(int id) const {
-        std::scoped_lock lock(mutex_);
+        Storage* storage = getStorage();
+        if (!storage)
+            return false;
 
-        return std::any_of(eventList_.begin(), eventList_.end(), [=] (auto& pair) {
-            return isEventListenerSuspended(pair.first, id);
-        });
+        auto lock = this->lock(*storage);
+        const Listener* listener = findListener(std::as_const(*storage), id);
+
+        if (listener)
+            return listener->isSuspended_;
+        else
+            return false;
     }
 
-    bool EventEmitter::hasEventListener(const std::string &event, int id) const {
-        return hasListener(event, id).first;
+    bool EventEmitter::hasEventListener(const EventKey& event, int id) const {
+        Storage* storage = getStorage();
+        if (!storage)
+            return false;
+
+        auto lock = this->lock(*storage);
+        return findListener(std::as_const(*storage), findListeners(std::as_const(*storage), event), id) != nullptr;
     }
 
     std::vector<std::string> EventEmitter::getEvents() const {
         std::vector<std::string> events;
 
-        for (const auto& pair : eventList_)
-            events.emplace_back(pair.first);
+        if (Storage* storage = getStorage(); storage) {
+            auto lock = this->lock(*storage);
+            for (const auto& pair : storage->eventList)
+                events.emplace_back(pair.second.name);
+        }
 
         return events;
     }
@@ -173,28 +320,239 @@ namespace ime {
         return isActive_;
     }
 
-    std::pair<bool, int> EventEmitter::hasListener(const std::string &event, int listenerId) const {
-        std::scoped_lock lock(mutex_);
-        if (hasEvent(event)) {
-            auto &eventListeners = eventList_.at(event);
-            auto found = std::find_if(eventListeners.begin(), eventListeners.end(), [=](const auto &listener) {
-                return listener->id_ == listenerId;
-            });
+    EventEmitter::ThreadingPolicy EventEmitter::getThreadingPolicy() const {
+        return threadingPolicy_;
+    }
+
+    EventEmitter::Storage* EventEmitter::getStorage() const {
+        return storage_.load(std::memory_order_acquire);
+    }
+
+    EventEmitter::Storage& EventEmitter::getOrCreateStorage() {
+        if (Storage* storage = getStorage(); storage)
+            return *storage;
+
+        // Another thread may add the first listener at the same time, the storage it publishes first wins
+        auto storage = std::make_unique<Storage>();
+        Storage* expected = nullptr;
+        if (storage_.compare_exchange_strong(expected, storage.get(), std::memory_order_acq_rel))
+            return *storage.release();
+
+        return *expected;
+    }
+
+    EventEmitter::Listener* EventEmitter::findListener(Storage& storage, int id) {
+        return const_cast<Listener*>(findListener(std::as_const(storage), id));
+    }
 
-            if (found != eventListeners.end())
-                return {true, std::distance(eventListeners.begin(), found)};
+    const EventEmitter::Listener* EventEmitter::findListener(const Storage& storage, int id) {
+        if (auto found = storage.listenerIndex.find(id); found != storage.listenerIndex.end())
+            return findListener(storage, found->second, id);
+
+        return nullptr;
+    }
+
+    EventEmitter::Listener* EventEmitter::findListener(Storage& storage, Listeners* listeners, int id) {
+        return const_cast<Listener*>(findListener(std::as_const(storage), listeners, id));
+    }
+
+    const EventEmitter::Listener* EventEmitter::findListener(const Storage& storage, const Listeners* listeners, int id) {
+        if (!listeners)
+            return nullptr;
+
+        auto found = std::find_if(listeners->begin(), listeners->end(), [id](const Listener& listener) {
+            return listener.id_ == id && !listener.isRemoved_;
+        });
+
+        if (found != listeners->end())
+            return &(*found);
+
+        const auto& pendingListeners = storage.pendingListeners;
+        auto pending = std::find_if(pendingListeners.begin(), pendingListeners.end(), [=](const PendingListener& pendingListener) {
+            return pendingListener.listeners == listeners && pendingListener.listener.id_ == id;
+        });
+
+        if (pending != pendingListeners.end())
+            return &pending->listener;
+
+        return nullptr;
+    }
+
+    bool EventEmitter::removeListener(Storage& storage, Listeners& listeners, int id) {
+        auto found = std::find_if(listeners.begin(), listeners.end(), [id](const Listener& listener) {
+            return listener.id_ == id && !listener.isRemoved_;
+        });
+
+        if (found != listeners.end()) {
+            if (storage.emitDepth > 0)
+                markRemoved(storage, listeners, *found);
+            else {
+                storage.listenerIndex.erase(id);
+                listeners.erase(found);
+            }
+
+            return true;
+        }
+
+        auto& pendingListeners = storage.pendingListeners;
+        auto pending = std::find_if(pendingListeners.begin(), pendingListeners.end(), [&listeners, id](const PendingListener& pendingListener) {
+            return pendingListener.listeners == &listeners && pendingListener.listener.id_ == id;
+        });
+
+        if (pending != pendingListeners.end()) {
+            storage.listenerIndex.erase(id);
+            pendingListeners.erase(pending);
+            return true;
         }
-        return {false, -1};
+
+        return false;
     }
 
-    EventEmitter::IListener* EventEmitter::getListener(const std::string &event, int id) {
-        return dynamic_cast<EventEmitter::IListener*>(const_cast<EventEmitter::IListener*>(std::as_const(*this).getListener(event, id)));
+    void EventEmitter::rebuildListenerIndex(Storage& storage) {
+        storage.listenerIndex.clear();
+
+        for (auto& pair : storage.eventList) {
+            for (const Listener& listener : pair.second.listeners)
+                storage.listenerIndex.emplace(listener.id_, &pair.second.listeners);
+        }
+    }
+
+    void EventEmitter::copyListeners(const Storage& source, Storage& destination) {
+        destination.eventList = source.eventList;
+
+        if (source.emitDepth > 0) {
+            for (auto& pair : destination.eventList) {
+                Listeners& listeners = pair.second.listeners;
+                listeners.erase(std::remove_if(listeners.begin(), listeners.end(), [](const Listener& listener) {
+                    return listener.isRemoved_;
+                }), listeners.end());
+            }
+
+            for (const PendingListener& pendingListener : source.pendingListeners) {
+                auto entry = std::find_if(source.eventList.begin(), source.eventList.end(), [&pendingListener](const auto& pair) {
+                    return &pair.second.listeners == pendingListener.listeners;
+                });
+
+                if (entry != source.eventList.end())
+                    destination.eventList.at(entry->first).listeners.push_back(pendingListener.listener);
+            }
+        }
+
+        rebuildListenerIndex(destination);
     }
 
-    const EventEmitter::IListener* EventEmitter::getListener(const std::string& event, int id) const {
-        if (auto [found, index] = hasListener(event, id); found)
-            return eventList_.at(event).at(index).get();
+    void EventEmitter::markRemoved(Storage& storage, Listeners& listeners, Listener& listener) {
+        listener.isRemoved_ = true;
+        storage.listenerIndex.erase(listener.id_);
+
+        auto& removedListeners = storage.removedListeners;
+        if (std::find(removedListeners.begin(), removedListeners.end(), &listeners) == removedListeners.end())
+            removedListeners.push_back(&listeners);
+    }
+
+    void EventEmitter::applyDeferredChanges(Storage& storage) {
+        // Each container is compacted once, no matter how many of its listeners were removed
+        for (Listeners* listeners : storage.removedListeners) {
+            listeners->erase(std::remove_if(listeners->begin(), listeners->end(), [](const Listener& listener) {
+                return listener.isRemoved_;
+            }), listeners->end());
+        }
+
+        storage.removedListeners.clear();
+
+        for (PendingListener& pendingListener : storage.pendingListeners)
+            pendingListener.listeners->push_back(std::move(pendingListener.listener));
+
+        storage.pendingListeners.clear();
+    }
+
+    EventEmitter::Listeners* EventEmitter::findListeners(Storage& storage, const EventKey& event) {
+        return const_cast<Listeners*>(findListeners(std::as_const(storage), event));
+    }
+
+    const EventEmitter::Listeners* EventEmitter::findListeners(const Storage& storage, const EventKey& event) {
+        // Events whose names have the same hash are stored in consecutive slots
+        for (Uint64 slot = event.getHash(); ; ++slot) {
+            auto found = storage.eventList.find(slot);
+            if (found == storage.eventList.end())
+                return nullptr;
+            else if (found->second.name == event.getName())
+                return &found->second.listeners;
+        }
+    }
+
+    EventEmitter::Listeners& EventEmitter::getOrCreateListeners(Storage& storage, const EventKey& event) {
+        Uint64 slot = event.getHash();
+        auto& eventList = storage.eventList;
+        for (auto found = eventList.find(slot); found != eventList.end(); found = eventList.find(++slot)) {
+            if (found->second.name == event.getName())
+                return found->second.listeners;
+        }
+
+        // Events are never removed individually, so the slot cannot break a probe sequence
+        EventEntry& entry = eventList[slot];
+        entry.name = std::string(event.getName());
+        return entry.listeners;
+    }
+
+    EventEmitter::Listener::Listener(const Listener& other) :
+        id_{other.id_},
+        isSuspended_{other.isSuspended_},
+        isCalledOnce_{other.isCalledOnce_},
+        isRemoved_{other.isRemoved_},
+        signature_{other.signature_},
+        operations_{other.operations_}
+    {
+        operations_->copy(callback_, other.callback_);
+    }
+
+    EventEmitter::Listener& EventEmitter::Listener::operator=(const Listener& other) {
+        if (this != &other) {
+            Listener temp{other};
+            *this = std::move(temp);
+        }
+
+        return *this;
+    }
+
+    EventEmitter::Listener::Listener(Listener&& other) noexcept :
+        id_{other.id_},
+        isSuspended_{other.isSuspended_},
+        isCalledOnce_{other.isCalledOnce_},
+        isRemoved_{other.isRemoved_},
+        signature_{other.signature_},
+        operations_{other.operations_}
+    {
+        operations_->move(callback_, other.callback_);
+    }
+
+    EventEmitter::Listener& EventEmitter::Listener::operator=(Listener&& other) noexcept {
+        if (this != &other) {
+            operations_->destroy(callback_);
+            id_ = other.id_;
+            isSuspended_ = other.isSuspended_;
+            isCalledOnce_ = other.isCalledOnce_;
+            isRemoved_ = other.isRemoved_;
+            signature_ = other.signature_;
+            operations_ = other.operations_;
+            operations_->move(callback_, other.callback_);
+        }
+
+        return *this;
+    }
+
+    EventEmitter::Listener::~Listener() {
+        operations_->destroy(callback_);
+    }
+
+    std::unique_lock<std::recursive_mutex> EventEmitter::lock(Storage& storage) const {
+        if (threadingPolicy_ == ThreadingPolicy::MultiThreaded)
+            return std::unique_lock<std::recursive_mutex>(storage.mutex);
         else
-            return nullptr;
+            return std::unique_lock<std::recursive_mutex>();
+    }
+
+    EventEmitter::~EventEmitter() {
+        delete storage_.load(std::memory_order_acquire);
     }
 }
@@ -0,0 +1,216 @@
+////////////////////////////////////////////////////////////////////////////////
+// IME - Infinite Motion Engine
+//
+// Copyright (c) 2020-2022 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef IME_EVENTQUEUE_H
+#define IME_EVENTQUEUE_H
+
+#include "IME/Config.h"
+#include "IME/core/event/EventEmitter.h"
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace ime::priv {
+    /**
+     * @brief An event that is waiting to be dispatched
+     */
+    struct QueuedEvent {
+        using Emit = std::function<void(EventEmitter&, const std::string&)>; //!< Emits the event with its arguments
+
+        std::atomic<QueuedEvent*> next{nullptr}; //!< The event that was posted after this one
+        std::string name;                        //!< The name of the event
+        Emit emit;                               //!< Emits the event
+        bool isCoalesced = false;                //!< Whether or not the event replaces a pending event with the same name
+    };
+
+    /**
+     * @brief Unbounded multiple producer, single consumer queue of events
+     *
+     * Producers never block, a post is one allocation and one atomic
+     * exchange. Events are delivered in the order in which they were
+     * posted. Only one thread at a time may consume the queue, dispatch()
+     * skips its turn if another thread is already dispatching or if it is
+     * called by a listener of a dispatched event
+     */
+    class EventQueue {
+    public:
+        /**
+         * @brief Default constructor
+         */
+        EventQueue() :
+            head_{&stub_},
+            tail_{&stub_}
+        {}
+
+        EventQueue(const EventQueue&) = delete;
+        EventQueue& operator=(const EventQueue&) = delete;
+
+        /**
+         * @brief Add an event to the queue
+         * @param event The event to be added
+         *
+         * This function may be called by multiple threads at the same time
+         */
+        void push(std::unique_ptr<QueuedEvent> event) {
+            link(event.release());
+        }
+
+        /**
+         * @brief Dispatch the queued events
+         * @param emitter The emitter to dispatch the events with
+         * @param budget The maximum number of events to dispatch, 0 for no limit
+         * @return The number of dispatched events
+         *
+         * Events that are not dispatched because of the budget remain in
+         * the queue for the next call
+         */
+        std::size_t dispatch(EventEmitter& emitter, std::size_t budget) {
+            if (isDispatching_.exchange(true, std::memory_order_acquire))
+                return 0;
+
+            struct DispatchGuard {
+                std::atomic<bool>& isDispatching;
+                ~DispatchGuard() { isDispatching.store(false, std::memory_order_release); }
+            } guard{isDispatching_};
+
+            // Move the posted events to the consumer side, merging coalesced events
+            while (QueuedEvent* event = pop()) {
+                std::unique_ptr<QueuedEvent> owned{event};
+
+                if (owned->isCoalesced) {
+                    if (auto found = coalesced_.find(owned->name); found != coalesced_.end()) {
+                        found->second->emit = std::move(owned->emit);
+                        continue;
+                    }
+
+                    coalesced_.emplace(owned->name, owned.get());
+                }
+
+                pending_.push_back(std::move(owned));
+            }
+
+            std::size_t count = 0;
+            while (!pending_.empty() && (budget == 0 || count < budget)) {
+                std::unique_ptr<QueuedEvent> event = std::move(pending_.front());
+                pending_.pop_front();
+
+                if (event->isCoalesced)
+                    coalesced_.erase(event->name);
+
+                event->emit(emitter, event->name);
+                ++count;
+            }
+
+            return count;
+        }
+
+        /**
+         * @brief Destructor
+         *
+         * Destroys the events that were not dispatched
+         */
+        ~EventQueue() {
+            while (QueuedEvent* event = pop())
+                delete event;
+        }
+
+    private:
+        /**
+         * @brief Append a node to the producer side of the queue
+         * @param event The node to be appended
+         */
+        void link(QueuedEvent* event) {
+            event->next.store(nullptr, std::memory_order_relaxed);
+            QueuedEvent* previous = head_.exchange(event, std::memory_order_acq_rel);
+            previous->next.store(event, std::memory_order_release);
+        }
+
+        /**
+         * @brief Remove the oldest event from the queue
+         * @return The removed event or a nullptr if the queue is empty or
+         *         the oldest event is still being linked by a producer
+         */
+        QueuedEvent* pop() {
+            QueuedEvent* tail = tail_;
+            QueuedEvent* next = tail->next.load(std::memory_order_acquire);
+
+            if (tail == &stub_) {
+                if (!next)
+                    return nullptr;
+
+                tail_ = next;
+                tail = next;
+                next = next->next.load(std::memory_order_acquire);
+            }
+
+            if (next) {
+                tail_ = next;
+                return tail;
+            }
+
+            if (tail != head_.load(std::memory_order_acquire))
+                return nullptr;
+
+            // Put the stub behind the last event so that it can be detached
+            link(&stub_);
+            next = tail->next.load(std::memory_order_acquire);
+            if (next) {
+                tail_ = next;
+                return tail;
+            }
+
+            return nullptr;
+        }
+
+    private:
+        QueuedEvent stub_;                                      //!< Placeholder that keeps the queue non-empty
+        std::atomic<QueuedEvent*> head_;                        //!< Most recently posted event (producer side)
+        QueuedEvent* tail_;                                     //!< Oldest event that was not popped (consumer side)
+        std::atomic<bool> isDispatching_{false};                //!< Ensures that there is only one consumer at a time
+        std::deque<std::unique_ptr<QueuedEvent>> pending_;      //!< Popped events waiting to be dispatched
+        std::unordered_map<std::string, QueuedEvent*> coalesced_; //!< Pending coalesced events by name
+    };
+
+    /**
+     * @brief Set the queue that receives the events posted by the calling thread
+     * @param queue The queue of the engine the thread belongs to, or a
+     *              nullptr if the thread does not belong to an engine
+     *
+     * Jobs of an ime::JobSystem inherit the queue of the thread that
+     * created them
+     */
+    void setThreadEventQueue(EventQueue* queue);
+
+    /**
+     * @brief Get the queue that receives the events posted by the calling thread
+     * @return The queue of the engine the thread belongs to, or a nullptr
+     *         if the thread does not belong to an engine
+     */
+    EventQueue* getThreadEventQueue();
+}
+
+#endif // IME_EVENTQUEUE_H
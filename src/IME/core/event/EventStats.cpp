@@ -0,0 +1,183 @@
+////////////////////////////////////////////////////////////////////////////////
+// IME - Infinite Motion Engine
+//
+// Copyright (c) 2020-2022 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "IME/core/event/EventStats.h"
+#include "IME/core/event/EventStatsCollector.h"
+#include <algorithm>
+#include <atomic>
+
+namespace ime {
+    namespace {
+        std::atomic<Uint64> eventStatsCollectorIdCounter{1};
+
+        // The number of emits in progress on the calling thread
+        thread_local unsigned int eventStatsEmitDepth = 0;
+
+        // The collector of the engine the calling thread belongs to
+        thread_local priv::EventStatsCollector* threadEventStatsCollector = nullptr;
+
+        // The counters the calling thread last recorded into, saves a lookup per emit
+        thread_local struct {
+            Uint64 collectorId = 0;
+            void* counters = nullptr;
+        } threadCountersCache;
+
+        priv::EventStatsCollector& getEventStatsCollector() {
+            if (threadEventStatsCollector)
+                return *threadEventStatsCollector;
+
+            // Records the threads that do not belong to an engine
+            static priv::EventStatsCollector collector;
+            return collector;
+        }
+    }
+
+    const EventStats::Entry* EventStats::find(const std::string& name) const {
+        auto found = std::find_if(events.begin(), events.end(), [&name](const Entry& entry) {
+            return entry.name == name;
+        });
+
+        return found != events.end() ? &(*found) : nullptr;
+    }
+
+    namespace priv {
+        EmitRecorder::EmitRecorder(const EventKey& event) :
+            event_{event},
+            start_{std::chrono::steady_clock::now()},
+            listenersInvoked_{0},
+            onceListenersRemoved_{0},
+            isOutermost_{eventStatsEmitDepth++ == 0}
+        {}
+
+        EmitRecorder::~EmitRecorder() {
+            auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - start_).count();
+            eventStatsEmitDepth--;
+
+            getEventStatsCollector().recordEmit(event_, listenersInvoked_, onceListenersRemoved_, duration, isOutermost_);
+        }
+
+        void recordQueuedEventsDispatched(std::size_t count) {
+            getEventStatsCollector().recordQueuedEventsDispatched(count);
+        }
+
+        EventStats collectEventStats() {
+            return getEventStatsCollector().collect();
+        }
+
+        EventStatsCollector::EventStatsCollector() :
+            id_{eventStatsCollectorIdCounter++}
+        {}
+
+        void EventStatsCollector::recordEmit(const EventKey& event, Uint64 listenersInvoked,
+            Uint64 onceListenersRemoved, Int64 duration, bool isOutermost)
+        {
+            ThreadCounters& threadCounters = getThreadCounters();
+            std::scoped_lock lock(threadCounters.mutex);
+            EventCounters& counters = threadCounters.events[event.getHash()];
+
+            if (counters.name.empty())
+                counters.name = std::string(event.getName());
+
+            counters.emitCount++;
+            counters.listenersInvoked += listenersInvoked;
+            counters.onceListenersRemoved += onceListenersRemoved;
+            counters.dispatchTime += duration;
+
+            if (isOutermost)
+                threadCounters.dispatchTime += duration;
+        }
+
+        void EventStatsCollector::recordQueuedEventsDispatched(std::size_t count) {
+            ThreadCounters& threadCounters = getThreadCounters();
+            std::scoped_lock lock(threadCounters.mutex);
+            threadCounters.queuedEventsDispatched += count;
+        }
+
+        EventStats EventStatsCollector::collect() {
+            EventStats stats;
+            std::scoped_lock lock(mutex_);
+            merged_.clear();
+
+            for (auto& [thread, threadCounters] : threads_) {
+                std::scoped_lock threadLock(threadCounters->mutex);
+
+                // Counters are reset instead of erased to avoid reallocating them every frame
+                for (auto& [hash, counters] : threadCounters->events) {
+                    if (counters.emitCount == 0)
+                        continue;
+
+                    auto [index, isNew] = merged_.try_emplace(hash, stats.events.size());
+                    if (isNew)
+                        stats.events.push_back({counters.name});
+
+                    EventStats::Entry& entry = stats.events[index->second];
+                    entry.emitCount += counters.emitCount;
+                    entry.listenersInvoked += counters.listenersInvoked;
+                    entry.onceListenersRemoved += counters.onceListenersRemoved;
+                    entry.dispatchTime += nanoseconds(counters.dispatchTime);
+
+                    stats.emitCount += counters.emitCount;
+                    stats.listenersInvoked += counters.listenersInvoked;
+                    stats.onceListenersRemoved += counters.onceListenersRemoved;
+                    counters.emitCount = counters.listenersInvoked = counters.onceListenersRemoved = 0;
+                    counters.dispatchTime = 0;
+                }
+
+                stats.queuedEventsDispatched += threadCounters->queuedEventsDispatched;
+                stats.dispatchTime += nanoseconds(threadCounters->dispatchTime);
+                threadCounters->queuedEventsDispatched = 0;
+                threadCounters->dispatchTime = 0;
+            }
+
+            std::sort(stats.events.begin(), stats.events.end(), [](const EventStats::Entry& lhs, const EventStats::Entry& rhs) {
+                return lhs.dispatchTime > rhs.dispatchTime;
+            });
+
+            return stats;
+        }
+
+        EventStatsCollector::ThreadCounters& EventStatsCollector::getThreadCounters() {
+            if (threadCountersCache.collectorId == id_)
+                return *static_cast<ThreadCounters*>(threadCountersCache.counters);
+
+            std::scoped_lock lock(mutex_);
+            std::unique_ptr<ThreadCounters>& counters = threads_[std::this_thread::get_id()];
+            if (!counters)
+                counters = std::make_unique<ThreadCounters>();
+
+            threadCountersCache.collectorId = id_;
+            threadCountersCache.counters = counters.get();
+            return *counters;
+        }
+
+        void setThreadEventStatsCollector(EventStatsCollector* collector) {
+            threadEventStatsCollector = collector;
+        }
+
+        EventStatsCollector* getThreadEventStatsCollector() {
+            return threadEventStatsCollector;
+        }
+    }
+}
@@ -0,0 +1,130 @@
+////////////////////////////////////////////////////////////////////////////////
+// IME - Infinite Motion Engine
+//
+// Copyright (c) 2020-2022 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef IME_EVENTSTATSCOLLECTOR_H
+#define IME_EVENTSTATSCOLLECTOR_H
+
+#include "IME/Config.h"
+#include "IME/core/event/EventStats.h"
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+namespace ime::priv {
+    /**
+     * @brief Accumulates the event statistics of a single engine
+     *
+     * Each thread accumulates into its own counters, so threads that record
+     * emits at the same time do not contend with each other. The counters
+     * of all threads are merged when the statistics are collected
+     */
+    class EventStatsCollector {
+    public:
+        /**
+         * @brief Default constructor
+         */
+        EventStatsCollector();
+
+        EventStatsCollector(const EventStatsCollector&) = delete;
+        EventStatsCollector& operator=(const EventStatsCollector&) = delete;
+
+        /**
+         * @brief Add an emit to the current frame
+         * @param event The event that was emitted
+         * @param listenersInvoked The number of listeners that were invoked
+         * @param onceListenersRemoved The number of one-time listeners that were removed
+         * @param duration The duration of the emit in nanoseconds
+         * @param isOutermost True if the emit was not nested in another emit
+         */
+        void recordEmit(const EventKey& event, Uint64 listenersInvoked,
+            Uint64 onceListenersRemoved, Int64 duration, bool isOutermost);
+
+        /**
+         * @brief Add dispatched queued events to the current frame
+         * @param count The number of events that were dispatched
+         */
+        void recordQueuedEventsDispatched(std::size_t count);
+
+        /**
+         * @brief Get the statistics of the current frame and start a new one
+         * @return The statistics recorded by all threads since the last call
+         */
+        EventStats collect();
+
+    private:
+        /**
+         * @brief Accumulated statistics of an event in the current frame
+         */
+        struct EventCounters {
+            std::string name;
+            Uint64 emitCount = 0;
+            Uint64 listenersInvoked = 0;
+            Uint64 onceListenersRemoved = 0;
+            Int64 dispatchTime = 0;
+        };
+
+        /**
+         * @brief Counters of a single thread
+         */
+        struct ThreadCounters {
+            std::mutex mutex; //!< Only contended while the statistics are collected
+            std::unordered_map<Uint64, EventCounters> events;
+            Uint64 queuedEventsDispatched = 0;
+            Int64 dispatchTime = 0;
+        };
+
+        /**
+         * @brief Get the counters of the calling thread
+         * @return The counters of the calling thread
+         */
+        ThreadCounters& getThreadCounters();
+
+    private:
+        const Uint64 id_;                //!< Tells collectors apart in the counters cache of a thread
+        std::mutex mutex_;               //!< Synchronizes access to the thread counters
+        std::unordered_map<std::thread::id, std::unique_ptr<ThreadCounters>> threads_; //!< The counters of each thread
+        std::unordered_map<Uint64, std::size_t> merged_; //!< Index of each event in the collected statistics
+    };
+
+    /**
+     * @brief Set the collector that records the emits of the calling thread
+     * @param collector The collector of the engine the thread belongs to,
+     *                  or a nullptr if the thread does not belong to an engine
+     *
+     * Emits of threads that do not belong to an engine are recorded by a
+     * shared collector. Jobs of an ime::JobSystem inherit the collector of
+     * the thread that created them
+     */
+    void setThreadEventStatsCollector(EventStatsCollector* collector);
+
+    /**
+     * @brief Get the collector that records the emits of the calling thread
+     * @return The collector of the engine the thread belongs to, or a
+     *         nullptr if the thread does not belong to an engine
+     */
+    EventStatsCollector* getThreadEventStatsCollector();
+}
+
+#endif // IME_EVENTSTATSCOLLECTOR_H
@@ -31,13 +31,24 @@ namespace ime::input {
     namespace {
         // Convert a key to string representation
         std::string keyToString(Keyboard::Key key);
+
+        // Lookup table for string to key conversion, built once on first use
+        const std::unordered_map<std::string, Keyboard::Key>& getStringKeyPairs() {
+            static const std::unordered_map<std::string, Keyboard::Key> stringKeyPairs = [] {
+                std::unordered_map<std::string, Keyboard::Key> pairs;
+                for (auto i = 0; i < static_cast<int>(Keyboard::Key::KeyCount); ++i)
+                    pairs.insert({keyToString(static_cast<Keyboard::Key>(i)), static_cast<Keyboard::Key>(i)});
+
+                return pairs;
+            }();
+
+            return stringKeyPairs;
+        }
     }
 
     Keyboard::Keyboard() {
-        for (auto i = 0; i < static_cast<int>(Key::KeyCount); ++i) {
+        for (auto i = 0; i < static_cast<int>(Key::KeyCount); ++i)
             wasDown_[i] = false;
-            stringKeyPairs_.insert({keyToString(static_cast<Key>(i)), static_cast<Key>(i)});
-        }
     }
 
     void Keyboard::setEnable(bool enable) {
@@ -53,12 +64,15 @@ namespace ime::input {
     }
 
     Key Keyboard::stringToKey(const std::string &key) {
-        if (stringKeyPairs_.find(key) == stringKeyPairs_.end()) {
+        const auto& stringKeyPairs = getStringKeyPairs();
+        auto found = stringKeyPairs.find(key);
+
+        if (found == stringKeyPairs.end()) {
             std::cerr << "Error: " << key << " is not a valid key" << std::endl;
             exit(-1);
         }
 
-        return stringKeyPairs_[key];
+        return found->second;
     }
 
     bool Keyboard::isKeyPressed(Key keyId) {
@@ -28,12 +28,22 @@
 #include "IME/utility/Helpers.h"
 
 namespace ime {
+    namespace {
+        // Events are looked up by precomputed keys
+        constexpr EventKey gameObjectContactBeginEvent{"GameObject_contactBegin"};
+        constexpr EventKey gameObjectContactEndEvent{"GameObject_contactEnd"};
+        constexpr EventKey gameObjectContactStayEvent{"GameObject_contactStay"};
+    }
+
     GameObject::GameObject(Scene& scene) :
         scene_{scene},
         state_{-1},
         isActive_{true},
         postStepId_{-1},
-        destructionId_{-1}
+        destructionId_{-1},
+        transformId_{-1},
+        transformDirtyId_{-1},
+        container_{nullptr}
     {
         initEvents();
     }
@@ -46,8 +56,14 @@ namespace ime {
         transform_{other.transform_},
         sprite_{other.sprite_},
         postStepId_{-1},
-        destructionId_{-1}
+        destructionId_{-1},
+        transformId_{-1},
+        transformDirtyId_{-1},
+        container_{nullptr}
     {
+        // The copied transform must not update the game object it was copied from
+        transform_.unsubscribe(other.transformId_);
+        transform_.unsubscribe(other.transformDirtyId_);
         initEvents();
 
         if (other.hasRigidBody())
@@ -59,6 +75,8 @@ namespace ime {
             auto temp{other};
             Object::operator=(temp);
             swap(temp);
+            transform_.unsubscribe(transformId_);
+            transform_.unsubscribe(transformDirtyId_);
             initEvents();
         }
 
@@ -66,9 +84,14 @@ namespace ime {
     }
 
     GameObject::GameObject(GameObject&& other) noexcept :
-        scene_(other.scene_)
+        scene_(other.scene_),
+        container_{nullptr}
     {
         *this = std::move(other);
+
+        // The moved transform must not update the game object it was moved from
+        transform_.unsubscribe(transformId_);
+        transform_.unsubscribe(transformDirtyId_);
         initEvents();
     }
 
@@ -91,6 +114,8 @@ namespace ime {
         std::swap(userData_, other.userData_);
         std::swap(postStepId_, other.postStepId_);
         std::swap(destructionId_, other.destructionId_);
+        std::swap(transformId_, other.transformId_);
+        std::swap(transformDirtyId_, other.transformDirtyId_);
     }
 
     GameObject::Ptr GameObject::create(Scene &scene) {
@@ -101,12 +126,25 @@ namespace ime {
         return std::make_unique<GameObject>(*this);
     }
 
+    void GameObject::reset() {
+        setState(-1);
+        userData_.clear();
+        transform_.setPosition(0.0f, 0.0f);
+        transform_.setRotation(0.0f);
+        transform_.setScale(1.0f, 1.0f);
+
+        if (body_)
+            body_->reset();
+
+        setActive(true);
+    }
+
     void GameObject::setState(int state) {
         if (state_ == state)
             return;
 
         state_ = state;
-        emitChange(Property{"state", state_});
+        emitChange("state", state_);
     }
 
     int GameObject::getState() const {
@@ -122,7 +160,7 @@ namespace ime {
         if (body_)
             body_->setEnabled(isActive_);
 
-        emitChange(Property{"active", isActive_});
+        emitChange("active", isActive_);
     }
 
     bool GameObject::isActive() const {
@@ -170,15 +208,15 @@ namespace ime {
     }
 
     int GameObject::onRigidBodyCollisionStart(const CollisionCallback& callback, bool oneTime) {
-        return utility::addEventListener(eventEmitter_, "GameObject_contactBegin", callback, oneTime);
+        return utility::addEventListener(eventEmitter_, gameObjectContactBeginEvent, callback, oneTime);
     }
 
     int GameObject::onRigidBodyCollisionEnd(const CollisionCallback& callback, bool oneTime) {
-        return utility::addEventListener(eventEmitter_, "GameObject_contactEnd", callback, oneTime);
+        return utility::addEventListener(eventEmitter_, gameObjectContactEndEvent, callback, oneTime);
     }
 
     int GameObject::onRigidBodyCollisionStay(const CollisionCallback &callback, bool oneTime) {
-        return utility::addEventListener(eventEmitter_, "GameObject_contactStay", callback, oneTime);
+        return utility::addEventListener(eventEmitter_, gameObjectContactStayEvent, callback, oneTime);
     }
 
     bool GameObject::hasRigidBody() const {
@@ -213,14 +251,19 @@ namespace ime {
         return sprite_;
     }
 
-    void GameObject::emitRigidBodyCollisionEvent(const std::string &event, GameObject* other) {
+    void GameObject::emitRigidBodyCollisionEvent(const EventKey& event, GameObject* other) {
         IME_ASSERT(other, "Internal Error, cannot collide with nullptr")
 
         // Prevent self collisions
         if (this == other)
             return;
 
-        eventEmitter_.emit("GameObject_" + event, this, other);
+        if (event == EventKey("contactBegin"))
+            eventEmitter_.emit(gameObjectContactBeginEvent, this, other);
+        else if (event == EventKey("contactEnd"))
+            eventEmitter_.emit(gameObjectContactEndEvent, this, other);
+        else if (event == EventKey("contactStay"))
+            eventEmitter_.emit(gameObjectContactStayEvent, this, other);
     }
 
     void GameObject::initEvents() {
@@ -235,28 +278,64 @@ namespace ime {
             postStepId_ = destructionId_ = -1;
         });
 
-        transform_.onPropertyChange([this](const Property& property) {
+        transformId_ = transform_.onPropertyChange([this](const Property& property) {
             const auto& name = property.getName();
             if (name == "position") {
                 if (body_)
                     body_->setPosition(transform_.getPosition());
 
                 sprite_.setPosition(transform_.getPosition());
-                emitChange(Property{name, transform_.getPosition()});
+                emitChange("position", transform_.getPosition());
             } else if (name == "origin") {
                 sprite_.setOrigin(transform_.getOrigin());
-                emitChange(Property{name, transform_.getOrigin()});
+                emitChange("origin", transform_.getOrigin());
             } else if (name == "scale") {
                 sprite_.setScale(transform_.getScale());
-                emitChange(Property{name, transform_.getScale()});
+                emitChange("scale", transform_.getScale());
             } else if (name == "rotation") {
                 if (body_)
                     body_->setRotation(transform_.getRotation());
 
                 sprite_.setRotation(transform_.getRotation());
-                emitChange(Property{name, transform_.getRotation()});
+                emitChange("rotation", transform_.getRotation());
+            } else if (name == "interpolationEnable") {
+                if (container_ && container_->findById(getObjectId()) == this)
+                    container_->setTransformInterpolated(getObjectId(), property.getValue<bool>());
             }
         });
+
+        // Only the game objects stored by the scene are flushed by it, the others are flushed right away
+        transformDirtyId_ = transform_.onDirty([this] {
+            if (container_ && container_->findById(getObjectId()) == this)
+                container_->markTransformDirty(getObjectId());
+            else
+                transform_.flushChanges();
+        });
+    }
+
+    void GameObject::restore(const GameObject &prototype) {
+        IME_ASSERT(!isActive_, "Only an inactive game object can be restored")
+
+        // Replaces the tag and the event listeners without notifying the listeners
+        Object::operator=(prototype);
+        state_ = prototype.state_;
+        userData_.clear();
+        sprite_ = prototype.sprite_;
+
+        // The rigid body is disabled, moving it does not touch the broad-phase
+        transform_.setPosition(prototype.transform_.getPosition());
+        transform_.setRotation(prototype.transform_.getRotation());
+        transform_.setScale(prototype.transform_.getScale());
+        transform_.setOrigin(prototype.transform_.getOrigin());
+        transform_.flushChanges();
+
+        if (body_ && prototype.body_) {
+            body_->setLinearVelocity(prototype.body_->getLinearVelocity());
+            body_->setAngularVelocity(prototype.body_->getAngularVelocity());
+            body_->setAwake(prototype.body_->isAwake());
+        }
+
+        setActive(true);
     }
 
     GameObject::~GameObject() {
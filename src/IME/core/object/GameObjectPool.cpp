@@ -0,0 +1,159 @@
+////////////////////////////////////////////////////////////////////////////////
+// IME - Infinite Motion Engine
+//
+// Copyright (c) 2020-2022 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "IME/core/object/GameObjectPool.h"
+
+namespace ime {
+    GameObjectPool::GameObjectPool() :
+        handle_{std::make_shared<GameObjectPool*>(this)}
+    {}
+
+    GameObjectPool::GameObjectPool(GameObjectPool&& other) noexcept :
+        pools_{std::move(other.pools_)},
+        keys_{std::move(other.keys_)},
+        handle_{std::move(other.handle_)}
+    {
+        if (handle_)
+            *handle_ = this;
+    }
+
+    GameObjectPool &GameObjectPool::operator=(GameObjectPool&& other) noexcept {
+        if (this != &other) {
+            if (handle_)
+                *handle_ = nullptr;
+
+            pools_ = std::move(other.pools_);
+            keys_ = std::move(other.keys_);
+            handle_ = std::move(other.handle_);
+
+            if (handle_)
+                *handle_ = this;
+        }
+
+        return *this;
+    }
+
+    void GameObjectPool::addPrototype(const std::string &key, GameObject::Ptr prototype) {
+        IME_ASSERT(prototype, "A prototype cannot be a nullptr")
+        IME_ASSERT(!hasPrototype(key), "A prototype with the key \"" + key + "\" already exists in the pool")
+
+        // Instances are copied from the prototype, so they are created inactive as well
+        prototype->setActive(false);
+        pools_.insert({key, Pool{std::move(prototype), {}}});
+    }
+
+    bool GameObjectPool::hasPrototype(const std::string &key) const {
+        return pools_.find(key) != pools_.end();
+    }
+
+    bool GameObjectPool::removePrototype(const std::string &key) {
+        if (pools_.erase(key) == 0)
+            return false;
+
+        // Instances that are still in use must not be released to a new prototype with the same key
+        for (auto iter = keys_.begin(); iter != keys_.end();) {
+            if (iter->second == key)
+                iter = keys_.erase(iter);
+            else
+                ++iter;
+        }
+
+        return true;
+    }
+
+    void GameObjectPool::reserve(const std::string &key, std::size_t count) {
+        IME_ASSERT(hasPrototype(key), "The pool does not have a prototype with the key \"" + key + "\"")
+        std::vector<GameObject::Ptr>& available = pools_.at(key).available;
+
+        while (available.size() < count)
+            available.push_back(createInstance(key));
+    }
+
+    GameObject::Ptr GameObjectPool::acquire(const std::string &key) {
+        IME_ASSERT(hasPrototype(key), "The pool does not have a prototype with the key \"" + key + "\"")
+        Pool& pool = pools_.at(key);
+
+        if (pool.available.empty()) {
+            GameObject::Ptr instance = createInstance(key);
+            instance->setActive(true);
+            return instance;
+        }
+
+        GameObject::Ptr instance = std::move(pool.available.back());
+        pool.available.pop_back();
+
+        // Restoring replaces the event listeners of the instance, including the one that tracks its destruction
+        instance->restore(*pool.prototype);
+        addDestructionListener(*instance);
+
+        return instance;
+    }
+
+    bool GameObjectPool::release(GameObject::Ptr gameObject) {
+        IME_ASSERT(gameObject, "Cannot release a nullptr to a game object pool")
+
+        auto key = keys_.find(gameObject->getObjectId());
+        if (key == keys_.end())
+            return false;
+
+        // The rigid body is disabled rather than destroyed
+        gameObject->setActive(false);
+        pools_.at(key->second).available.push_back(std::move(gameObject));
+        return true;
+    }
+
+    std::size_t GameObjectPool::getAvailableCount(const std::string &key) const {
+        if (auto pool = pools_.find(key); pool != pools_.end())
+            return pool->second.available.size();
+
+        return 0;
+    }
+
+    void GameObjectPool::clear() {
+        pools_.clear();
+        keys_.clear();
+    }
+
+    GameObject::Ptr GameObjectPool::createInstance(const std::string &key) {
+        GameObject::Ptr instance = pools_.at(key).prototype->copy();
+        keys_.emplace(instance->getObjectId(), key);
+        addDestructionListener(*instance);
+
+        return instance;
+    }
+
+    void GameObjectPool::addDestructionListener(GameObject &instance) {
+        // Instances may be destroyed instead of released. The handle is checked because the pool may be destroyed first
+        instance.onDestruction([handle = std::weak_ptr<GameObjectPool*>(handle_), id = instance.getObjectId()] {
+            if (auto pool = handle.lock(); pool && *pool)
+                (*pool)->keys_.erase(id);
+        });
+    }
+
+    GameObjectPool::~GameObjectPool() {
+        // The instances must not access the pool while they are destroyed
+        if (handle_)
+            *handle_ = nullptr;
+    }
+}
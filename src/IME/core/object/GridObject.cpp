@@ -28,6 +28,19 @@
 #include "IME/utility/Helpers.h"
 
 namespace ime {
+    namespace {
+        // Events are looked up by precomputed keys
+        constexpr EventKey gridObjectGridEnterEvent{"GridObject_gridEnter"};
+        constexpr EventKey gridObjectGridExitEvent{"GridObject_gridExit"};
+        constexpr EventKey gridObjectMoveBeginEvent{"GridObject_moveBegin"};
+        constexpr EventKey gridObjectPreMoveEvent{"GridObject_preMove"};
+        constexpr EventKey gridObjectPostMoveEvent{"GridObject_postMove"};
+        constexpr EventKey gridObjectMoveEndEvent{"GridObject_moveEnd"};
+        constexpr EventKey gridObjectObjectCollisionEvent{"GridObject_objectCollision"};
+        constexpr EventKey gridObjectBorderCollisionEvent{"GridObject_borderCollision"};
+        constexpr EventKey gridObjectTileCollisionEvent{"GridObject_tileCollision"};
+    }
+
     GridObject::GridObject(Scene &scene) :
         GameObject(scene),
         grid_{nullptr},
@@ -84,7 +97,7 @@ namespace ime {
     void GridObject::setDirection(const Vector2i &dir) {
         if (direction_ != dir) {
             direction_ = dir;
-            emitChange(Property{"direction", dir});
+            emitChange("direction", dir);
         }
     }
 
@@ -95,7 +108,7 @@ namespace ime {
     void GridObject::setObstacle(bool isObstacle) {
         if (isObstacle_ != isObstacle) {
             isObstacle_ = isObstacle;
-            emitChange(Property{"obstacle", isObstacle_});
+            emitChange("obstacle", isObstacle_);
         }
     }
 
@@ -106,7 +119,7 @@ namespace ime {
     void GridObject::setCollisionId(int id) {
         if (collisionId_ != id) {
             collisionId_ = id;
-            emitChange(Property{"collisionId", collisionId_});
+            emitChange("collisionId", collisionId_);
         }
     }
 
@@ -117,7 +130,7 @@ namespace ime {
     void GridObject::setCollisionGroup(const std::string &name) {
         if (collisionGroup_ != name) {
             collisionGroup_ = name;
-            emitChange(Property{"collisionGroup", collisionGroup_});
+            emitChange("collisionGroup", collisionGroup_);
         }
     }
 
@@ -128,7 +141,7 @@ namespace ime {
     void GridObject::setSpeed(const Vector2f &speed) {
         if (speed_ != speed) {
             speed_ = speed;
-            emitChange(Property{"speed", speed});
+            emitChange("speed", speed);
         }
     }
 
@@ -183,39 +196,39 @@ namespace ime {
     }
 
     int GridObject::onGridEnter(const Callback<GridObject*> &callback, bool oneTime) {
-        return utility::addEventListener(eventEmitter_, "GridObject_gridEnter", callback, oneTime);
+        return utility::addEventListener(eventEmitter_, gridObjectGridEnterEvent, callback, oneTime);
     }
 
     int GridObject::onGridExit(const Callback<GridObject*> &callback, bool oneTime) {
-        return utility::addEventListener(eventEmitter_, "GridObject_gridExit", callback, oneTime);
+        return utility::addEventListener(eventEmitter_, gridObjectGridExitEvent, callback, oneTime);
     }
 
     int GridObject::onGridMoveBegin(const Callback<GridObject*>& callback, bool oneTime) {
-        return utility::addEventListener(eventEmitter_, "GridObject_moveBegin", callback, oneTime);
+        return utility::addEventListener(eventEmitter_, gridObjectMoveBeginEvent, callback, oneTime);
     }
 
     int GridObject::onGridPreMove(const Callback<GridObject *> &callback, bool oneTime) {
-        return utility::addEventListener(eventEmitter_, "GridObject_preMove", callback, oneTime);
+        return utility::addEventListener(eventEmitter_, gridObjectPreMoveEvent, callback, oneTime);
     }
 
     int GridObject::onGridPostMove(const Callback<GridObject *> &callback, bool oneTime) {
-        return utility::addEventListener(eventEmitter_, "GridObject_postMove", callback, oneTime);
+        return utility::addEventListener(eventEmitter_, gridObjectPostMoveEvent, callback, oneTime);
     }
 
     int GridObject::onGridMoveEnd(const Callback<GridObject*>& callback, bool oneTime) {
-        return utility::addEventListener(eventEmitter_, "GridObject_moveEnd", callback, oneTime);
+        return utility::addEventListener(eventEmitter_, gridObjectMoveEndEvent, callback, oneTime);
     }
 
     int GridObject::onGridObjectCollision(const Callback<GridObject*, GridObject*> &callback, bool oneTime) {
-        return utility::addEventListener(eventEmitter_, "GridObject_objectCollision", callback, oneTime);
+        return utility::addEventListener(eventEmitter_, gridObjectObjectCollisionEvent, callback, oneTime);
     }
 
     int GridObject::onGridBorderCollision(const Callback<GridObject*> &callback, bool oneTime) {
-        return utility::addEventListener(eventEmitter_, "GridObject_borderCollision", callback, oneTime);
+        return utility::addEventListener(eventEmitter_, gridObjectBorderCollisionEvent, callback, oneTime);
     }
 
     int GridObject::onGridTileCollision(const Callback<GridObject*, Index> &callback, bool oneTime) {
-        return utility::addEventListener(eventEmitter_, "GridObject_tileCollision", callback, oneTime);
+        return utility::addEventListener(eventEmitter_, gridObjectTileCollisionEvent, callback, oneTime);
     }
 
     void GridObject::setGridMover(GridMover *gridMover) {
@@ -229,30 +242,34 @@ namespace ime {
                     setGrid(nullptr);
 
                 grid_ = grid;
-                eventEmitter_.emit("GridObject_gridEnter", this);
+                eventEmitter_.emit(gridObjectGridEnterEvent, this);
             } else if (grid_) {
                 grid_ = nullptr;
-                eventEmitter_.emit("GridObject_gridExit", this);
+                eventEmitter_.emit(gridObjectGridExitEvent, this);
             }
         }
     }
 
     void GridObject::emitGridEvent(const Property& property) {
-        if ((property.getName() == "borderCollision") ||
-            (property.getName() == "moveBegin") ||
-            (property.getName() == "moveEnd") ||
-            (property.getName() == "preMove") ||
-            (property.getName() == "postMove"))
-        {
-            eventEmitter_.emit("GridObject_" + property.getName(), this);
-        }
+        const std::string& name = property.getName();
+
+        if (name == "borderCollision")
+            eventEmitter_.emit(gridObjectBorderCollisionEvent, this);
+        else if (name == "moveBegin")
+            eventEmitter_.emit(gridObjectMoveBeginEvent, this);
+        else if (name == "moveEnd")
+            eventEmitter_.emit(gridObjectMoveEndEvent, this);
+        else if (name == "preMove")
+            eventEmitter_.emit(gridObjectPreMoveEvent, this);
+        else if (name == "postMove")
+            eventEmitter_.emit(gridObjectPostMoveEvent, this);
         else {
             IME_ASSERT(property.hasValue(), "Internal error: Raising grid event without arguments")
 
-            if (property.getName() == "tileCollision")
-                eventEmitter_.emit("GridObject_" + property.getName(), this, property.getValue<Index>());
-            else if (property.getName() == "objectCollision")
-                eventEmitter_.emit("GridObject_" + property.getName(), this, property.getValue<GridObject*>());
+            if (name == "tileCollision")
+                eventEmitter_.emit(gridObjectTileCollisionEvent, this, property.getValue<Index>());
+            else if (name == "objectCollision")
+                eventEmitter_.emit(gridObjectObjectCollisionEvent, this, property.getValue<GridObject*>());
         }
     }
 
@@ -24,20 +24,77 @@
 
 #include "IME/core/object/Object.h"
 #include "IME/utility/Helpers.h"
+#include <atomic>
+#include <cstring>
 
 namespace ime {
     namespace {
-        unsigned int objectIdCounter = 0u;
+        std::atomic<unsigned int> objectIdCounter{0u};
+
+        // Events are looked up by precomputed keys
+        constexpr EventKey objectPropertyChangeEvent{"Object_propertyChange"};
+        constexpr EventKey objectTypedPropertyChangeEvent{"Object_typedPropertyChange"};
+        constexpr EventKey objectDestructionEvent{"Object_destruction"};
+
+        /**
+         * @brief Call a function with the key of the change event of a property
+         * @param property The name of the property
+         * @param function The function to be called
+         *
+         * The name of the event is built on the stack instead of the heap
+         */
+        template <typename Function>
+        auto withPropertyChangeEvent(std::string_view property, Function&& function) {
+            constexpr std::string_view prefix = "Object_";
+            constexpr std::string_view suffix = "Change";
+
+            char eventName[64];
+            const std::size_t eventNameLength = prefix.size() + property.size() + suffix.size();
+            if (eventNameLength <= sizeof(eventName)) {
+                std::memcpy(eventName, prefix.data(), prefix.size());
+                std::memcpy(eventName + prefix.size(), property.data(), property.size());
+                std::memcpy(eventName + prefix.size() + property.size(), suffix.data(), suffix.size());
+                return function(EventKey(std::string_view(eventName, eventNameLength)));
+            } else
+                return function(EventKey("Object_" + std::string(property) + "Change"));
+        }
+
+        /**
+         * @brief Convert the value of a property to a typed property value
+         * @param property The property whose value is to be converted
+         * @return The value as the first of the given types that it matches,
+         *         or an ime::AnyPropertyValue referring to the property if
+         *         it matches none of them
+         */
+        template <typename T, typename... Rest>
+        PropertyValue toPropertyValueOf(const Property& property) {
+            if (const T* value = property.getValueIf<T>())
+                return makePropertyValue(*value);
+            else if constexpr (sizeof...(Rest) > 0)
+                return toPropertyValueOf<Rest...>(property);
+            else
+                return PropertyValue{std::in_place_type<AnyPropertyValue>, property};
+        }
+
+        PropertyValue toPropertyValue(const Property& property) {
+            if (!property.hasValue())
+                return {};
+
+            return toPropertyValueOf<bool, int, unsigned int, float, std::string,
+                Vector2f, Vector2i, Index>(property);
+        }
     }
 
     Object::Object() :
-        id_{objectIdCounter++}
+        id_{objectIdCounter++},
+        hasNamedPropertyListeners_{false}
     {}
 
     Object::Object(const Object& other) :
         eventEmitter_{other.eventEmitter_},
         id_{objectIdCounter++},
-        tag_{other.tag_}
+        tag_{other.tag_},
+        hasNamedPropertyListeners_{other.hasNamedPropertyListeners_}
     {
         eventEmitter_.removeAllEventListeners("Object_destruction");
     }
@@ -45,9 +102,37 @@ namespace ime {
     Object &Object::operator=(const Object & other) {
         // We don't want to assign the object id, each must have a unique one
         if (this != &other) {
+            bool isTagChanged = tag_ != other.tag_;
             tag_ = other.tag_;
             eventEmitter_ = other.eventEmitter_;
+            hasNamedPropertyListeners_ = other.hasNamedPropertyListeners_;
             eventEmitter_.removeAllEventListeners("Object_destruction");
+
+            if (isTagChanged && tagIndexUpdater_)
+                tagIndexUpdater_();
+        }
+
+        return *this;
+    }
+
+    Object::Object(Object&& other) noexcept :
+        eventEmitter_{std::move(other.eventEmitter_)},
+        id_{other.id_},
+        tag_{std::move(other.tag_)},
+        hasNamedPropertyListeners_{other.hasNamedPropertyListeners_}
+    {}
+
+    Object &Object::operator=(Object&& other) noexcept {
+        if (this != &other) {
+            bool isTagChanged = tag_ != other.tag_;
+            eventEmitter_ = std::move(other.eventEmitter_);
+            id_ = other.id_;
+            tag_ = std::move(other.tag_);
+            hasNamedPropertyListeners_ = other.hasNamedPropertyListeners_;
+
+            // The updater belongs to the container that stores this object
+            if (isTagChanged && tagIndexUpdater_)
+                tagIndexUpdater_();
         }
 
         return *this;
@@ -56,7 +141,11 @@ namespace ime {
     void Object::setTag(const std::string &tag) {
         if (tag_ != tag) {
             tag_ = tag;
-            emitChange(Property{"tag", tag_});
+
+            if (tagIndexUpdater_)
+                tagIndexUpdater_();
+
+            emitChange("tag", tag_);
         }
     }
 
@@ -73,11 +162,16 @@ namespace ime {
     }
 
     int Object::onPropertyChange(const std::string &property, const Callback<Property>& callback, bool oneTime) {
+        hasNamedPropertyListeners_ = true;
         return utility::addEventListener(eventEmitter_, "Object_" + property + "Change", callback, oneTime);
     }
 
     int Object::onPropertyChange(const Callback<Property> &callback, bool oneTime) {
-        return utility::addEventListener(eventEmitter_, "Object_propertyChange", callback, oneTime);
+        return utility::addEventListener(eventEmitter_, objectPropertyChangeEvent, callback, oneTime);
+    }
+
+    int Object::onTypedPropertyChange(const Callback<const PropertyChange&> &callback, bool oneTime) {
+        return utility::addEventListener(eventEmitter_, objectTypedPropertyChangeEvent, callback, oneTime);
     }
 
     void Object::suspendedEventListener(int id, bool suspend) {
@@ -103,7 +197,7 @@ namespace ime {
     }
 
     int Object::onDestruction(const Callback<>& callback) {
-        return eventEmitter_.addOnceEventListener("Object_destruction", callback);
+        return eventEmitter_.addOnceEventListener(objectDestructionEvent, callback);
     }
 
     bool Object::isSameObjectAs(const Object &other) const {
@@ -111,12 +205,43 @@ namespace ime {
     }
 
     void Object::emitChange(const Property &property) {
-        eventEmitter_.emit("Object_" + property.getName() + "Change", property);
-        eventEmitter_.emit("Object_propertyChange", property);
+        emitUntypedChange(property);
+
+        if (hasTypedPropertyChangeListeners()) {
+            const std::string& name = property.getName();
+            emitTypedChange(PropertyChange{PropertyChange::idOf(name), name, toPropertyValue(property)});
+        }
+    }
+
+    void Object::emitUntypedChange(const Property &property) {
+        withPropertyChangeEvent(property.getName(), [this, &property](const EventKey& event) {
+            eventEmitter_.emit(event, property);
+        });
+
+        eventEmitter_.emit(objectPropertyChangeEvent, property);
+    }
+
+    bool Object::hasTypedPropertyChangeListeners() const {
+        return eventEmitter_.getEventListenerCount(objectTypedPropertyChangeEvent) > 0;
+    }
+
+    bool Object::hasPropertyChangeListeners(const EventKey& property) const {
+        if (eventEmitter_.getEventListenerCount(objectPropertyChangeEvent) > 0)
+            return true;
+        else if (!hasNamedPropertyListeners_)
+            return false;
+
+        return withPropertyChangeEvent(property.getName(), [this](const EventKey& event) {
+            return eventEmitter_.getEventListenerCount(event) > 0;
+        });
+    }
+
+    void Object::emitTypedChange(const PropertyChange &change) {
+        eventEmitter_.emit<const PropertyChange&>(objectTypedPropertyChangeEvent, change);
     }
 
     void Object::emitDestruction() {
-        eventEmitter_.emit("Object_destruction");
+        eventEmitter_.emit(objectDestructionEvent);
     }
 
     Object::~Object() {
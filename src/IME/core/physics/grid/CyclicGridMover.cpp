@@ -59,7 +59,7 @@ namespace ime {
     void CyclicGridMover::setCycleDirection(CyclicGridMover::CycleDirection direction) {
         if (direction_ != direction) {
             direction_ = direction;
-            emitChange(Property{"cycleDirection", direction});
+            emitChange("cycleDirection", direction);
         }
     }
 
@@ -30,6 +30,17 @@ using namespace std::string_literals;
 
 namespace ime {
     namespace {
+        // Events are looked up by precomputed keys
+        constexpr EventKey gridMoverDirectionChangeEvent{"GridMover_directionChange"};
+        constexpr EventKey gridMoverMoveBeginEvent{"GridMover_moveBegin"};
+        constexpr EventKey gridMoverPreMoveEvent{"GridMover_preMove"};
+        constexpr EventKey gridMoverPostMoveEvent{"GridMover_postMove"};
+        constexpr EventKey gridMoverTileCollisionEvent{"GridMover_tileCollision"};
+        constexpr EventKey gridMoverObjectCollisionEvent{"GridMover_objectCollision"};
+        constexpr EventKey gridMoverBorderCollisionEvent{"GridMover_borderCollision"};
+        constexpr EventKey gridMoverMoveEndEvent{"GridMover_moveEnd"};
+        constexpr EventKey gridMoverTargetTileResetEvent{"GridMover_targetTileReset"};
+
         bool isSupportedDirection(const Direction& dir) {
             return dir == Left || dir == UpLeft || dir == Up || dir == UpRight
                 || dir == Right ||dir == DownRight || dir == Down || dir == DownLeft;
@@ -116,9 +127,9 @@ namespace ime {
                 targetDestructionId_ = targetPropertyChangeId_ = -1;
             });
 
-            targetPropertyChangeId_ = target->onPropertyChange([this](const Property& property) {
-                if (property.getName() == "speed") {
-                    maxSpeed_ = property.getValue<Vector2f>();
+            targetPropertyChangeId_ = target->onTypedPropertyChange([this](const PropertyChange& change) {
+                if (change.id == PropertyChange::idOf("speed")) {
+                    maxSpeed_ = std::get<Vector2f>(change.value);
 
                     // The position of the target is updated by the physics engine and not by the grid mover
                     if (target_->hasRigidBody()) {
@@ -144,7 +155,7 @@ namespace ime {
             target_ = target;
         }
 
-        emitChange(Property{"target", target_});
+        emitChange("target", target_);
     }
 
     GridMover::Type GridMover::getType() const {
@@ -164,7 +175,7 @@ namespace ime {
         }
 
         maxSpeed_ = {std::abs(speed.x), std::abs(speed.y)};
-        emitChange(Property{"maxLinearSpeed", speed});
+        emitChange("maxLinearSpeed", speed);
     }
 
     const Vector2f& GridMover::getSpeed() const {
@@ -174,7 +185,7 @@ namespace ime {
     void GridMover::setSpeedMultiplier(float multiplier) {
         if (multiplier >= 0.0f && speedMultiplier_ != multiplier) {
             speedMultiplier_ = multiplier;
-            emitChange(Property{"speedMultiplier", speedMultiplier_});
+            emitChange("speedMultiplier", speedMultiplier_);
         }
     }
 
@@ -196,7 +207,7 @@ namespace ime {
         }
 
         moveRestrict_ = moveRestriction;
-        emitChange(Property{"movementRestriction", moveRestrict_});
+        emitChange("movementRestriction", moveRestrict_);
     }
 
     GridMover::MoveRestriction GridMover::getMovementRestriction() const {
@@ -215,7 +226,7 @@ namespace ime {
                     target_->getRigidBody()->setLinearVelocity({0.0f, 0.0f});
             }
 
-            emitChange(Property{"movementFreeze", isMoveFrozen_});
+            emitChange("movementFreeze", isMoveFrozen_);
         }
     }
 
@@ -251,7 +262,7 @@ namespace ime {
 
         if (!isTargetMoving() && targetDirection_ == Unknown) {
             targetDirection_ = dir;
-            eventEmitter_.emit("GridMover_directionChange", targetDirection_);
+            eventEmitter_.emit(gridMoverDirectionChangeEvent, targetDirection_);
             target_->setDirection(dir);
 
             return true;
@@ -328,7 +339,7 @@ namespace ime {
                 // to smoothly move there
                 target_->getTransform().setPosition(currentPosition);
 
-                eventEmitter_.emit("GridMover_moveBegin");
+                eventEmitter_.emit(gridMoverMoveBeginEvent);
                 target_->emitGridEvent(Property{"moveBegin"});
             }
             else if (isMoving_) {
@@ -336,13 +347,13 @@ namespace ime {
                     snapTargetToTargetTile();
                     onDestinationReached();
                 } else if (!target_->hasRigidBody()) {
-                    eventEmitter_.emit("GridMover_preMove");
+                    eventEmitter_.emit(gridMoverPreMoveEvent);
                     target_->emitGridEvent(Property("preMove"));
 
                     target_->getTransform().move(maxSpeed_.x * targetDirection_.x * deltaTime.asSeconds() * speedMultiplier_,
                                                  maxSpeed_.y * targetDirection_.y * deltaTime.asSeconds() * speedMultiplier_);
 
-                    eventEmitter_.emit("GridMover_postMove");
+                    eventEmitter_.emit(gridMoverPostMoveEvent);
                     target_->emitGridEvent(Property("postMove"));
                 }
             }
@@ -432,7 +443,7 @@ namespace ime {
             if (target_->hasRigidBody())
                 target_->getRigidBody()->setLinearVelocity({0.0f, 0.0f});
 
-            eventEmitter_.emit("GridMover_tileCollision", hitTile->getIndex());
+            eventEmitter_.emit(gridMoverTileCollisionEvent, hitTile->getIndex());
             target_->emitGridEvent(Property{"tileCollision", hitTile->getIndex()});
 
             return true;
@@ -456,7 +467,7 @@ namespace ime {
             if (target_->hasRigidBody())
                 target_->getRigidBody()->setLinearVelocity({0.0f, 0.0f});
 
-            eventEmitter_.emit("GridMover_objectCollision", target_, obstacle);
+            eventEmitter_.emit(gridMoverObjectCollisionEvent, target_, obstacle);
             target_->emitGridEvent(Property{"objectCollision", obstacle});
             obstacle->emitGridEvent(Property{"objectCollision", target_});
 
@@ -487,7 +498,7 @@ namespace ime {
             if (target_->hasRigidBody())
                 target_->getRigidBody()->setLinearVelocity({0.0f, 0.0f});
 
-            eventEmitter_.emit("GridMover_borderCollision", targetTile_->getIndex());
+            eventEmitter_.emit(gridMoverBorderCollisionEvent, targetTile_->getIndex());
             target_->emitGridEvent(Property{"borderCollision"});
 
             return true;
@@ -518,12 +529,12 @@ namespace ime {
             if (!canCollide(gameObject))
                 return;
 
-            eventEmitter_.emit("GridMover_objectCollision", target_, gameObject);
+            eventEmitter_.emit(gridMoverObjectCollisionEvent, target_, gameObject);
             target_->emitGridEvent(Property{"objectCollision", gameObject});
             gameObject->emitGridEvent(Property{"objectCollision", target_});
         });
 
-        eventEmitter_.emit("GridMover_moveEnd", targetTile_->getIndex());
+        eventEmitter_.emit(gridMoverMoveEndEvent, targetTile_->getIndex());
         target_->emitGridEvent(Property{"moveEnd"});
     }
 
@@ -552,36 +563,36 @@ namespace ime {
             != grid_.getTileOccupiedByChild(target_).getIndex())
         {
             targetTile_ = &grid_.getTileOccupiedByChild(target_);
-            eventEmitter_.emit("GridMover_targetTileReset", targetTile_);
+            eventEmitter_.emit(gridMoverTargetTileResetEvent, targetTile_);
         }
     }
 
     int GridMover::onDirectionChange(const Callback<Direction> &callback, bool oneTime) {
-        return utility::addEventListener(eventEmitter_, "GridMover_directionChange", callback, oneTime);
+        return utility::addEventListener(eventEmitter_, gridMoverDirectionChangeEvent, callback, oneTime);
     }
 
     int GridMover::onMoveBegin(const Callback<Index> &callback, bool oneTime) {
-        return utility::addEventListener(eventEmitter_, "GridMover_moveBegin", callback, oneTime);
+        return utility::addEventListener(eventEmitter_, gridMoverMoveBeginEvent, callback, oneTime);
     }
 
     int GridMover::onMoveEnd(const Callback<Index> &callback, bool oneTime) {
-        return utility::addEventListener(eventEmitter_, "GridMover_moveEnd", callback, oneTime);
+        return utility::addEventListener(eventEmitter_, gridMoverMoveEndEvent, callback, oneTime);
     }
 
     int GridMover::onObjectCollision(const Callback<GridObject *, GridObject *> &callback, bool oneTime) {
-        return utility::addEventListener(eventEmitter_, "GridMover_objectCollision", callback, oneTime);
+        return utility::addEventListener(eventEmitter_, gridMoverObjectCollisionEvent, callback, oneTime);
     }
 
     int GridMover::onBorderCollision(const Callback<> &callback, bool oneTime) {
-        return utility::addEventListener(eventEmitter_, "GridMover_borderCollision", callback, oneTime);
+        return utility::addEventListener(eventEmitter_, gridMoverBorderCollisionEvent, callback, oneTime);
     }
 
     int GridMover::onTileCollision(const Callback<Index> &callback, bool oneTime) {
-        return utility::addEventListener(eventEmitter_, "GridMover_tileCollision", callback, oneTime);
+        return utility::addEventListener(eventEmitter_, gridMoverTileCollisionEvent, callback, oneTime);
     }
 
     int GridMover::onTargetTileReset(const Callback<Index>& callback, bool oneTime) {
-        return utility::addEventListener(eventEmitter_, "GridMover_targetTileReset", callback, oneTime);
+        return utility::addEventListener(eventEmitter_, gridMoverTargetTileResetEvent, callback, oneTime);
     }
 
     GridMover::~GridMover() {
@@ -58,7 +58,7 @@ namespace ime {
 
             trigger_ = trigger;
             attachInputEventListeners();
-            emitChange(Property{"movementTrigger", trigger});
+            emitChange("movementTrigger", trigger);
         }
     }
 
@@ -69,7 +69,7 @@ namespace ime {
     void KeyboardGridMover::setKeys(const TriggerKeys &triggerKeys) {
         if (triggerKeys_ != triggerKeys) {
             triggerKeys_ = triggerKeys;
-            emitChange(Property{"keys", triggerKeys});
+            emitChange("keys", triggerKeys);
         }
     }
 
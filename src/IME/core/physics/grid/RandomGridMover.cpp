@@ -101,7 +101,7 @@ namespace ime {
 
         // Randomize the directions so that the direction the target chooses
         // to go in is not predictable
-        auto static randomEngine = std::default_random_engine{std::random_device{}()};
+        auto thread_local randomEngine = std::default_random_engine{std::random_device{}()};
         std::shuffle(directionAttempts_.begin(), directionAttempts_.end(), randomEngine);
 
         do {
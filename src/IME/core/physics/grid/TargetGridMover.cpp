@@ -237,7 +237,7 @@ namespace ime {
             return;
 
         isAdaptiveMoveEnabled_ = enable;
-        emitChange(Property{"adaptiveMoveEnable", isAdaptiveMoveEnabled_});
+        emitChange("adaptiveMoveEnable", isAdaptiveMoveEnabled_);
     }
 
     bool TargetGridMover::isAdaptiveMoveEnabled() const {
@@ -271,7 +271,7 @@ namespace ime {
                 Index index = path.top();
                 path.pop();
                 Vector2u gridTileSize = getGrid().getTileSize();
-                static RectangleShape shape;
+                thread_local RectangleShape shape;
                 shape.setSize(Vector2f{static_cast<float>(gridTileSize.x), static_cast<float>(gridTileSize.y)});
                 shape.setPosition(getGrid().getTile(index).getPosition());
 
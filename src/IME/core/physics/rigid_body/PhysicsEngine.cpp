@@ -34,6 +34,11 @@
 namespace ime {
     namespace
     {
+        // Contact events forwarded to colliders
+        constexpr EventKey physicsContactBeginEvent{"contactBegin"};
+        constexpr EventKey physicsContactEndEvent{"contactEnd"};
+        constexpr EventKey physicsContactStayEvent{"contactStay"};
+
         /**
          * @brief Convert Box2d fixture to own collider
          * @param fixture Box2d fixture to be converted
@@ -116,12 +121,12 @@ namespace ime {
     public:
         // Called by Box2d when two fixtures begin to overlap
         void BeginContact(b2Contact *contact) override {
-            emit("contactBegin", contact);
+            emit(physicsContactBeginEvent, contact);
         }
 
         // Called by Box2d when two fixtures stop overlapping
         void EndContact(b2Contact *contact) override {
-            emit("contactEnd", contact);
+            emit(physicsContactEndEvent, contact);
         }
 
         // Called by Box2d after collision detection, but before collision
@@ -130,12 +135,12 @@ namespace ime {
         // called if the body that the fixture is attached to is not awake
         // or when the body is awake but the fixture is a sensor
         void PreSolve(b2Contact *contact, const b2Manifold*) override {
-            emit("contactStay", contact);
+            emit(physicsContactStayEvent, contact);
         }
 
     private:
         // Emit contact events
-        static void emit(const std::string& event, b2Contact *contact) {
+        static void emit(const EventKey& event, b2Contact *contact) {
             auto colliderA = convertFixtureToCollider(contact->GetFixtureA());
             auto colliderB = convertFixtureToCollider(contact->GetFixtureB());
 
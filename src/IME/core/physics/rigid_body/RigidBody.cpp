@@ -78,6 +78,21 @@ namespace ime {
         return body;
     }
 
+    void RigidBody::reset() {
+        if (world_->isLocked()) {
+            IME_PRINT_WARNING("Operation ignored: reset() called inside a world callback")
+            return;
+        }
+
+        // Applied forces are cleared by the world after each step (see PhysicsEngine::autoClearForces)
+        setPosition({0.0f, 0.0f});
+        setRotation(0.0f);
+        setLinearVelocity({0.0f, 0.0f});
+        setAngularVelocity(0.0f);
+        setEnabled(true);
+        setAwake(true);
+    }
+
     std::string RigidBody::getClassName() const {
         return "RigidBody";
     }
@@ -123,7 +138,7 @@ namespace ime {
             {utility::pixelsToMetres(position.x), utility::pixelsToMetres(position.y)},
             body_->GetAngle());
 
-        emitChange(Property{"position", position});
+        emitChange("position", position);
     }
 
     Vector2f RigidBody::getPosition() const {
@@ -135,7 +150,7 @@ namespace ime {
             return;
 
         body_->SetTransform(body_->GetTransform().p, utility::degToRad(angle));
-        emitChange(Property{"rotation", angle});
+        emitChange("rotation", angle);
     }
 
     float RigidBody::getRotation() const {
@@ -156,7 +171,7 @@ namespace ime {
             return;
 
         body_->SetLinearVelocity({utility::pixelsToMetres(velocity.x), utility::pixelsToMetres(velocity.y)});
-        emitChange(Property{"linearVelocity", velocity});
+        emitChange("linearVelocity", velocity);
     }
 
     Vector2f RigidBody::getLinearVelocity() const {
@@ -168,7 +183,7 @@ namespace ime {
             return;
 
         body_->SetAngularVelocity(utility::degToRad(degrees));
-        emitChange(Property{"angularVelocity",  degrees});
+        emitChange("angularVelocity", degrees);
     }
 
     float RigidBody::getAngularVelocity() const {
@@ -252,7 +267,7 @@ namespace ime {
             return;
 
         body_->SetLinearDamping(damping);
-        emitChange(Property{"linearDamping", damping});
+        emitChange("linearDamping", damping);
     }
 
     float RigidBody::getLinearDamping() const {
@@ -261,7 +276,7 @@ namespace ime {
 
     void RigidBody::setAngularDamping(float damping) {
         body_->SetAngularDamping(damping);
-        emitChange(Property{"angularDamping", damping});
+        emitChange("angularDamping", damping);
     }
 
     float RigidBody::getAngularDamping() const {
@@ -273,7 +288,7 @@ namespace ime {
             return;
 
         body_->SetGravityScale(scale);
-        emitChange(Property{"gravityScale", scale});
+        emitChange("gravityScale", scale);
     }
 
     float RigidBody::getGravityScale() const {
@@ -290,7 +305,7 @@ namespace ime {
         }
 
         body_->SetType(static_cast<b2BodyType>(type));
-        emitChange(Property{"type", type});
+        emitChange("type", type);
     }
 
     RigidBody::Type RigidBody::getType() const {
@@ -302,7 +317,7 @@ namespace ime {
             return;
 
         body_->SetBullet(fast);
-        emitChange(Property{"fastBody", fast});
+        emitChange("fastBody", fast);
     }
 
     bool RigidBody::isFastBody() const {
@@ -314,7 +329,7 @@ namespace ime {
             return;
 
         body_->SetSleepingAllowed(sleeps);
-        emitChange(Property{"sleepingAllowed", sleeps});
+        emitChange("sleepingAllowed", sleeps);
     }
 
     bool RigidBody::isSleepingAllowed() const {
@@ -326,7 +341,7 @@ namespace ime {
             return;
 
         body_->SetAwake(awake);
-        emitChange(Property{"awake", awake});
+        emitChange("awake", awake);
     }
 
     bool RigidBody::isAwake() const {
@@ -343,7 +358,7 @@ namespace ime {
         }
 
         body_->SetEnabled(enable);
-        emitChange(Property{"enable", enable});
+        emitChange("enable", enable);
     }
 
     bool RigidBody::isEnabled() const {
@@ -355,7 +370,7 @@ namespace ime {
             return;
 
         body_->SetFixedRotation(rotate);
-        emitChange(Property{"fixedRotation", rotate});
+        emitChange("fixedRotation", rotate);
     }
 
     bool RigidBody::isFixedRotation() const {
@@ -367,7 +382,7 @@ namespace ime {
             return;
 
         gameObject_ = gameObject;
-        emitChange(Property{"gameObject", gameObject_});
+        emitChange("gameObject", gameObject_);
     }
 
     GameObject* RigidBody::getGameObject() {
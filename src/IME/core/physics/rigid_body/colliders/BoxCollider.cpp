@@ -82,7 +82,7 @@ namespace ime {
         box_->SetAsBox(utility::pixelsToMetres(width / 2.0f),
             utility::pixelsToMetres(height / 2.0f));
 
-        emitChange(Property{"size", size_});
+        emitChange("size", size_);
     }
 
     void BoxCollider::setSize(const Vector2f& size) {
@@ -74,7 +74,7 @@ namespace ime {
 
         circle_->m_p.x = utility::pixelsToMetres(position.x);
         circle_->m_p.y = utility::pixelsToMetres(position.y);
-        emitChange(Property{"position", position});
+        emitChange("position", position);
     }
 
     Vector2f CircleCollider::getPosition() const {
@@ -86,7 +86,7 @@ namespace ime {
             return;
 
         circle_->m_radius = utility::pixelsToMetres(radius);
-        emitChange(Property{"radius", radius});
+        emitChange("radius", radius);
     }
 
     float CircleCollider::getRadius() const {
@@ -29,6 +29,13 @@
 #include <box2d/b2_fixture.h>
 
 namespace ime {
+    namespace {
+        // Contact events emitted by the physics engine
+        constexpr EventKey colliderContactBeginEvent{"contactBegin"};
+        constexpr EventKey colliderContactEndEvent{"contactEnd"};
+        constexpr EventKey colliderContactStayEvent{"contactStay"};
+    }
+
     Collider::Collider(Collider::Type type) :
         type_{type},
         body_{nullptr},
@@ -104,7 +111,7 @@ namespace ime {
         hasRigidBody_ = true;
         updateCollisionFilter();
 
-        emitChange(Property{"body", body_});
+        emitChange("body", body_);
     }
 
     RigidBody* Collider::getBody() {
@@ -120,7 +127,7 @@ namespace ime {
             return;
 
         fixture_->SetSensor(sensor);
-        emitChange(Property{"sensor", sensor});
+        emitChange("sensor", sensor);
     }
 
     bool Collider::isSensor() const {
@@ -130,7 +137,7 @@ namespace ime {
     void Collider::setCollisionFilter(const CollisionFilterData& filterData) {
         filterData_ = filterData;
         updateCollisionFilter();
-        emitChange(Property{"collisionFilter", filterData});
+        emitChange("collisionFilter", filterData);
     }
 
     const CollisionFilterData& Collider::getCollisionFilterData() const {
@@ -155,7 +162,7 @@ namespace ime {
         }
         updateCollisionFilter();
 
-        emitChange(Property{"enable", enable});
+        emitChange("enable", enable);
     }
 
     bool Collider::isAttachedToBody() const {
@@ -173,7 +180,7 @@ namespace ime {
         IME_ASSERT(density >= 0, "A collider cannot have a negative density")
         fixture_->SetDensity(density);
         body_->getInternalBody()->ResetMassData();
-        emitChange(Property{"density", density});
+        emitChange("density", density);
     }
 
     float Collider::getDensity() const {
@@ -185,7 +192,7 @@ namespace ime {
             return;
 
         fixture_->SetFriction(friction);
-        emitChange(Property{"friction", friction});
+        emitChange("friction", friction);
     }
 
     float Collider::getFriction() const {
@@ -197,7 +204,7 @@ namespace ime {
             return;
 
         fixture_->SetRestitution(restitution);
-        emitChange(Property{"restitution", restitution});
+        emitChange("restitution", restitution);
     }
 
     float Collider::getRestitution() const {
@@ -209,7 +216,7 @@ namespace ime {
             return;
 
         fixture_->SetRestitutionThreshold(threshold);
-        emitChange(Property{"restitutionThreshold", threshold});
+        emitChange("restitutionThreshold", threshold);
     }
 
     float Collider::getRestitutionThreshold() const {
@@ -232,15 +239,15 @@ namespace ime {
         onContactStay_ = callback;
     }
 
-    void Collider::emitContact(const std::string &event, Collider *other) {
+    void Collider::emitContact(const EventKey& event, Collider *other) {
         if (this == other)
             return;
 
-        if (event == "contactBegin" && onContactBegin_)
+        if (event == colliderContactBeginEvent && onContactBegin_)
             onContactBegin_(this, other);
-        else if (event == "contactEnd" && onContactEnd_)
+        else if (event == colliderContactEndEvent && onContactEnd_)
             onContactEnd_(this, other);
-        else if (event == "contactStay" && onContactStay_)
+        else if (event == colliderContactStayEvent && onContactStay_)
             onContactStay_(this, other);
 
         GameObject* gameObjectA = body_->getGameObject();
@@ -39,6 +39,7 @@ namespace ime {
     {}
 
     bool ResourceManager::loadFromFile(ResourceType type, const std::string &filename){
+        std::scoped_lock lock(mutex_);
         switch (type) {
             case ResourceType::Texture:
                 return textures_.loadFromFile(filename);
@@ -67,6 +68,7 @@ namespace ime {
         const std::initializer_list<std::string>& filenames,
         const Callback<const std::string&>& callback)
     {
+        std::scoped_lock lock(mutex_);
         std::for_each(filenames.begin(), filenames.end(),
             [=](const std::string& filename) {
                 if (loadFromFile(type, filename) && callback)
@@ -75,22 +77,27 @@ namespace ime {
     }
 
     const sf::Font &ResourceManager::getFont(const std::string &fileName) {
+        std::scoped_lock lock(mutex_);
         return *(fonts_.get(fileName));
     }
 
     const Texture &ResourceManager::getTexture(const std::string &fileName) {
+        std::scoped_lock lock(mutex_);
         return *(textures_.get(fileName));
     }
 
     const sf::Image &ResourceManager::getImage(const std::string &fileName) {
+        std::scoped_lock lock(mutex_);
         return *(images_.get(fileName));
     }
 
     const sf::SoundBuffer &ResourceManager::getSoundBuffer(const std::string &fileName) {
+        std::scoped_lock lock(mutex_);
         return *(soundBuffers_.get(fileName));
     }
 
     std::shared_ptr<sf::Music> ResourceManager::getMusic(const std::string &fileName) {
+        std::scoped_lock lock(mutex_);
         try {
             return musicHolder_.at(fileName);
         } catch (...) {
@@ -100,6 +107,7 @@ namespace ime {
     }
 
     bool ResourceManager::unload(ResourceType type, const std::string &filename) {
+        std::scoped_lock lock(mutex_);
         switch (type) {
             case ResourceType::Texture:
                 return textures_.unload(filename);
@@ -121,6 +129,7 @@ namespace ime {
     }
 
     void ResourceManager::unloadAll(ResourceType type) {
+        std::scoped_lock lock(mutex_);
         switch (type) {
             case ResourceType::Texture:
                 textures_.unloadAll();
@@ -141,6 +150,7 @@ namespace ime {
     }
 
     void ResourceManager::unloadAll() {
+        std::scoped_lock lock(mutex_);
         fonts_.unloadAll();
         textures_.unloadAll();
         images_.unloadAll();
@@ -149,6 +159,7 @@ namespace ime {
     }
 
     std::string ResourceManager::getPathFor(ResourceType type) const {
+        std::scoped_lock lock(mutex_);
         switch (type) {
             case ResourceType::Texture:
                 return textures_.getPath();
@@ -166,6 +177,7 @@ namespace ime {
     }
 
     void ResourceManager::setPathFor(ResourceType type, const std::string& path) {
+        std::scoped_lock lock(mutex_);
         switch (type) {
             case ResourceType::Font:
                 fonts_.setPath(path);
@@ -187,6 +199,8 @@ namespace ime {
     }
 
     std::shared_ptr<ResourceManager> ResourceManager::getInstance() {
+        static std::mutex instanceMutex;
+        std::scoped_lock lock(instanceMutex);
         static std::weak_ptr<ResourceManager> instance_;
         if (const auto result = instance_.lock())
             return result;
@@ -31,6 +31,7 @@
 #include <string>
 #include <initializer_list>
 #include <functional>
+#include <mutex>
 
 namespace sf {
     class Music;
@@ -44,6 +45,10 @@ namespace ime {
     /**
      * @brief Class for loading and storing resources (textures, fonts,
      *        sound buffers, images and music)
+     *
+     * The resource manager is shared by every engine in the process. Loaded
+     * resources and resource paths are therefore process-wide, access to
+     * them is synchronized so that engines may run on separate threads
      */
     class ResourceManager final {
     public:
@@ -193,6 +198,7 @@ namespace ime {
         ResourceHolder<sf::SoundBuffer> soundBuffers_; //!< Sound buffers container
         std::string musicPath_;
         std::unordered_map<std::string, std::shared_ptr<sf::Music>> musicHolder_;
+        mutable std::recursive_mutex mutex_; //!< Synchronizes access from multiple engines
     };
 }
 
@@ -23,6 +23,8 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "IME/core/scene/GameObjectContainer.h"
+#include "IME/core/scene/Scene.h"
+#include <algorithm>
 
 namespace ime {
     GameObjectContainer::GameObjectContainer(RenderLayerContainer &renderLayers) :
@@ -40,6 +42,79 @@ namespace ime {
     {
         IME_ASSERT(gameObject, "Cannot add nullptr to a GameObjectContainer")
         renderLayers_.get().add(gameObject->getSprite(), renderOrder, renderLayer);
-        return addObject(std::move(gameObject), group);
+        GameObject* added = addObject(std::move(gameObject), group);
+
+        // Deferred transforms are only flushed by the container of the scene
+        if (&added->getScene().getGameObjects() == this) {
+            added->container_ = this;
+
+            // The transform may have become dirty before the game object was added
+            if (added->getTransform().isDirty())
+                markTransformDirty(added->getObjectId());
+
+            if (added->getTransform().isInterpolationEnabled())
+                setTransformInterpolated(added->getObjectId(), true);
+        } else
+            added->getTransform().flushChanges();
+
+        return added;
+    }
+
+    GameObject::Ptr GameObjectContainer::extractById(unsigned int id) {
+        GameObject::Ptr gameObject = ObjectContainer<GameObject>::extractById(id);
+
+        if (gameObject) {
+            setTransformInterpolated(id, false);
+            gameObject->container_ = nullptr;
+            renderLayers_.get().forEachLayer([&gameObject](const RenderLayer::Ptr& layer) {
+                layer->remove(gameObject->getSprite());
+            });
+        }
+
+        return gameObject;
+    }
+
+    void GameObjectContainer::markTransformDirty(unsigned int id) {
+        std::scoped_lock lock(dirtyTransformsMutex_);
+        dirtyTransforms_.push_back(id);
+    }
+
+    void GameObjectContainer::syncTransforms() {
+        {
+            std::scoped_lock lock(dirtyTransformsMutex_);
+            std::swap(dirtyTransforms_, flushedTransforms_);
+        }
+
+        // Transforms changed by a listener are flushed by the next call
+        for (unsigned int id : flushedTransforms_) {
+            if (GameObject* gameObject = findById(id))
+                gameObject->getTransform().flushChanges();
+        }
+
+        flushedTransforms_.clear();
+    }
+
+    void GameObjectContainer::setTransformInterpolated(unsigned int id, bool interpolated) {
+        auto found = std::find(interpolated_.begin(), interpolated_.end(), id);
+
+        if (interpolated && found == interpolated_.end())
+            interpolated_.push_back(id);
+        else if (!interpolated && found != interpolated_.end()) {
+            *found = interpolated_.back();
+            interpolated_.pop_back();
+        }
+    }
+
+    void GameObjectContainer::forEachInterpolated(const Callback<GameObject*>& callback) {
+        for (std::size_t i = 0; i < interpolated_.size();) {
+            // Game objects that were destroyed are removed lazily
+            if (GameObject* gameObject = findById(interpolated_[i])) {
+                callback(gameObject);
+                i++;
+            } else {
+                interpolated_[i] = interpolated_.back();
+                interpolated_.pop_back();
+            }
+        }
     }
 }
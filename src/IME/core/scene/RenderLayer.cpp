@@ -41,7 +41,7 @@ namespace ime {
     void RenderLayer::setDrawable(bool render) {
         if (shouldRender_ != render) {
             shouldRender_ = render;
-            emitChange(Property{"drawable", render});
+            emitChange("drawable", render);
         }
     }
 
@@ -37,11 +37,13 @@ namespace ime {
         isBackgroundSceneDrawable_{true},
         isBackgroundSceneUpdated_{true},
         isBackgroundSceneEventsEnabled_{false},
+        eventMask_{EventMask::all()},
         hasPhysicsSim_{false},
         hasGrid2D_{false},
         cacheState_{false, ""},
         parentScene_{nullptr},
         spriteContainer_{std::make_unique<SpriteContainer>(renderLayers_)},
+        gameObjectPool_{std::make_unique<GameObjectPool>()},
         entityContainer_{std::make_unique<GameObjectContainer>(renderLayers_)},
         shapeContainer_{std::make_unique<ShapeContainer>(renderLayers_)}
     {
@@ -69,6 +71,7 @@ namespace ime {
             timerManager_ = std::move(other.timerManager_);
             guiContainer_ = std::move(other.guiContainer_);
             renderLayers_ = std::move(other.renderLayers_);
+            gameObjectPool_ = std::move(other.gameObjectPool_);
             entityContainer_ = std::move(other.entityContainer_);
             gridMovers_ = std::move(other.gridMovers_);
             shapeContainer_ = std::move(other.shapeContainer_);
@@ -78,6 +81,7 @@ namespace ime {
             isBackgroundSceneDrawable_ = other.isBackgroundSceneDrawable_;
             isBackgroundSceneUpdated_ = other.isBackgroundSceneUpdated_;
             isBackgroundSceneEventsEnabled_ = other.isBackgroundSceneEventsEnabled_;
+            eventMask_ = other.eventMask_;
             hasPhysicsSim_ = other.hasPhysicsSim_;
             hasGrid2D_ = other.hasGrid2D_;
             cacheState_ = other.cacheState_;
@@ -104,7 +108,10 @@ namespace ime {
             camera_ = std::make_unique<Camera>(engine.getRenderTarget());
             cache_ = std::make_unique<std::reference_wrapper<PropertyContainer>>(engine.getCache());
             sCache_ = std::make_unique<std::reference_wrapper<PrefContainer>>(engine.getSavableCache());
-            guiContainer_.setTarget(engine.getRenderTarget());
+
+            if (!engine.isHeadless())
+                guiContainer_.setTarget(engine.getRenderTarget());
+
             onInit();
         }
     }
@@ -130,7 +137,7 @@ namespace ime {
         if (isVisibleWhenPaused_ != visible) {
             isVisibleWhenPaused_ = visible;
 
-            emitChange(Property("visibleOnPause", isVisibleWhenPaused_));
+            emitChange("visibleOnPause", isVisibleWhenPaused_);
         }
     }
 
@@ -200,7 +207,7 @@ namespace ime {
         if (isBackgroundSceneDrawable_ != drawable) {
             isBackgroundSceneDrawable_ = drawable;
 
-            emitChange(Property("backgroundSceneDrawable", drawable));
+            emitChange("backgroundSceneDrawable", drawable);
         }
     }
 
@@ -212,7 +219,7 @@ namespace ime {
         if (isBackgroundSceneUpdated_ != enable) {
             isBackgroundSceneUpdated_ = enable;
 
-            emitChange(Property("backgroundSceneUpdateEnable", isBackgroundSceneUpdated_));
+            emitChange("backgroundSceneUpdateEnable", isBackgroundSceneUpdated_);
         }
     }
 
@@ -224,7 +231,7 @@ namespace ime {
         if (isBackgroundSceneEventsEnabled_ != enable) {
             isBackgroundSceneEventsEnabled_ = enable;
 
-            emitChange(Property("backgroundSceneEventsEnable", enable));
+            emitChange("backgroundSceneEventsEnable", enable);
         }
     }
 
@@ -232,6 +239,14 @@ namespace ime {
         return isBackgroundSceneEventsEnabled_;
     }
 
+    void Scene::setEventMask(const EventMask &mask) {
+        eventMask_ = mask;
+    }
+
+    const EventMask& Scene::getEventMask() const {
+        return eventMask_;
+    }
+
     bool Scene::isEntered() const {
         return isEntered_;
     }
@@ -249,7 +264,7 @@ namespace ime {
         else
             timescale_ = timescale;
 
-        emitChange(Property{"timescale", timescale});
+        emitChange("timescale", timescale);
     }
 
     float Scene::getTimescale() const {
@@ -343,6 +358,14 @@ namespace ime {
         return timerManager_;
     }
 
+    JobSystem &Scene::getJobSystem() {
+        return getEngine().getJobSystem();
+    }
+
+    const JobSystem &Scene::getJobSystem() const {
+        return getEngine().getJobSystem();
+    }
+
     EventEmitter &Scene::getEventEmitter() {
         return eventEmitter_;
     }
@@ -423,6 +446,14 @@ namespace ime {
         return *entityContainer_;
     }
 
+    GameObjectPool &Scene::getGameObjectPool() {
+        return *gameObjectPool_;
+    }
+
+    const GameObjectPool &Scene::getGameObjectPool() const {
+        return *gameObjectPool_;
+    }
+
     SpriteContainer &Scene::getSprites() {
         return *spriteContainer_;
     }
@@ -31,6 +31,13 @@
 
 namespace ime::priv {
     namespace {
+        // Scene internal events are looked up by precomputed keys
+        constexpr EventKey scenePostRenderEvent{"postRender"};
+        constexpr EventKey scenePreUpdateEvent{"preUpdate"};
+        constexpr EventKey scenePreStepEvent{"preStep"};
+        constexpr EventKey scenePostStepEvent{"postStep"};
+        constexpr EventKey scenePostUpdateEvent{"postUpdate"};
+
         void resetGui(ui::GuiContainer& gui) {
             // Reset focus state
             gui.unfocusAllWidgets();
@@ -311,7 +318,7 @@ namespace ime::priv {
     }
 
     void SceneManager::render(priv::RenderTarget &window) {
-        auto static renderScene = [](Scene* scene, Camera* camera, priv::RenderTarget& renderWindow) {
+        auto renderScene = [this](Scene* scene, Camera* camera, priv::RenderTarget& renderWindow) {
             scene->onPreRender();
 
             if (!camera->isDrawable())
@@ -319,7 +326,7 @@ namespace ime::priv {
 
             // Reset view so that the scene can be rendered on the current camera
             const sf::View& view = std::any_cast<std::reference_wrapper<const sf::View>>(camera->getInternalView()).get();
-            renderWindow.getThirdPartyWindow().setView(view);
+            renderWindow.setView(view);
 
             if (scene->hasGrid2D_) {
                 scene->grid2D_->draw(renderWindow);
@@ -328,30 +335,32 @@ namespace ime::priv {
 
             scene->renderLayers_.render(renderWindow);
 
-            // render gui
-            scene->guiContainer_.draw();
+            // render gui (Drawn separately when recording, see renderGui)
+            if (!renderWindow.isRecording())
+                scene->guiContainer_.draw();
 
             // Render camera outline
-            static RectangleShape camOutline;
-
             auto [x, y, width, height] = camera->getBounds();
-            camOutline.setSize({width, height});
-            camOutline.setPosition(x, y);
-            camOutline.setFillColour(Colour::Transparent);
-            camOutline.setOutlineThickness(-camera->getOutlineThickness());
-            camOutline.setOutlineColour(camera->getOutlineColour());
-            renderWindow.draw(camOutline);
+            camOutline_.setSize({width, height});
+            camOutline_.setPosition(x, y);
+            camOutline_.setFillColour(Colour::Transparent);
+            camOutline_.setOutlineThickness(-camera->getOutlineThickness());
+            camOutline_.setOutlineColour(camera->getOutlineColour());
+            renderWindow.draw(camOutline_);
 
             scene->onPostRender();
 
             // Notify scene rendering process is complete
-            scene->internalEmitter_.emit("postRender", std::ref(renderWindow));
+            scene->internalEmitter_.emit(scenePostRenderEvent, std::ref(renderWindow));
         };
 
         // Render the scene on each camera to update its view
-        auto static renderEachCam = [](Scene* scene, priv::RenderTarget& renderTarget) {
+        auto renderEachCam = [&renderScene](Scene* scene, priv::RenderTarget& renderTarget) {
+            syncTransforms(scene);
+            interpolateTransforms(scene, scene->getEngine().getFixedUpdateAlpha());
+
             // Render secondary cameras
-            scene->getCameras().forEach([scene, &renderTarget](Camera* secondaryCam) {
+            scene->getCameras().forEach([scene, &renderTarget, &renderScene](Camera* secondaryCam) {
                 renderScene(scene, secondaryCam, renderTarget);
             });
 
@@ -359,15 +368,27 @@ namespace ime::priv {
             renderScene(scene, &scene->getCamera(), renderTarget);
         };
 
+        forEachRenderedScene([&renderEachCam, &window](Scene* scene) {
+            renderEachCam(scene, window);
+        });
+    }
+
+    void SceneManager::renderGui() {
+        forEachRenderedScene([](Scene* scene) {
+            scene->guiContainer_.draw();
+        });
+    }
+
+    void SceneManager::forEachRenderedScene(const Callback<Scene*>& callback) {
         if (!scenes_.empty() && scenes_.top()->isEntered()) {
             // Render previous scene
             if (prevScene_ && prevScene_->isEntered() && prevScene_->isVisibleOnPause()) {
                 Scene* bgScene = prevScene_->getBackgroundScene();
 
                 if (bgScene && prevScene_->isBackgroundSceneDrawable())
-                    renderEachCam(bgScene, window);
+                    callback(bgScene);
 
-                renderEachCam(prevScene_, window);
+                callback(prevScene_);
             }
 
             // Render the active scenes background scene
@@ -375,10 +396,10 @@ namespace ime::priv {
             Scene* bgScene = activeScene->getBackgroundScene();
 
             if(bgScene && activeScene->isBackgroundSceneDrawable())
-                renderEachCam(bgScene, window);
+                callback(bgScene);
 
             // Render the active scene
-            renderEachCam(activeScene, window);
+            callback(activeScene);
         }
     }
 
@@ -394,7 +415,7 @@ namespace ime::priv {
             return;
 
         // Handle a camera's response to a window resize event
-        static auto updateCameraScale = [](Camera* camera, unsigned int windowWidth, unsigned int windowHeight) {
+        auto updateCameraScale = [](Camera* camera, unsigned int windowWidth, unsigned int windowHeight) {
             Camera::OnWinResize response = camera->getWindowResizeResponse();
 
             if (response == Camera::OnWinResize::Letterbox) {
@@ -405,9 +426,12 @@ namespace ime::priv {
         };
 
         // Update all system components of a scene
-        static auto updateSystem = [](Scene* scene, Event e) {
+        // A headless engine has no gui target
+        const bool isGuiEnabled = !engine_->isHeadless();
+
+        auto updateSystem = [&updateCameraScale, isGuiEnabled](Scene* scene, Event e) {
             if (e.type == Event::Resized) {
-                scene->getCameras().forEach([&e](Camera* camera) {
+                scene->getCameras().forEach([&e, &updateCameraScale](Camera* camera) {
                     updateCameraScale(camera, e.size.width, e.size.height);
                 });
 
@@ -437,10 +461,17 @@ namespace ime::priv {
                 return;
             }
 
-            scene->inputManager_.handleEvent(e);
-            scene->guiContainer_.handleEvent(e);
-            scene->gridMovers_.handleEvent(e);
-            scene->onHandleEvent(e);
+            if (EventMasks::Input.contains(e.type))
+                scene->inputManager_.handleEvent(e);
+
+            if (isGuiEnabled && !EventMasks::Joystick.contains(e.type))
+                scene->guiContainer_.handleEvent(e);
+
+            if (GridMoverContainer::getEventMask().contains(e.type))
+                scene->gridMovers_.handleEvent(e);
+
+            if (scene->getEventMask().contains(e.type))
+                scene->onHandleEvent(e);
         };
 
         Scene* activeScene = scenes_.top().get();
@@ -477,10 +508,10 @@ namespace ime::priv {
         if (!scenes_.top()->isEntered())
             return;
 
-        static auto update = [](Scene* scene, Time dt) {
+        auto update = [](Scene* scene, Time dt) {
             scene->timerManager_.preUpdate();
             scene->audioManager_.removePlayedAudio();
-            scene->internalEmitter_.emit("preUpdate", dt * scene->getTimescale());
+            scene->internalEmitter_.emit(scenePreUpdateEvent, dt * scene->getTimescale());
         };
 
         Scene* activeScene = scenes_.top().get();
@@ -510,9 +541,27 @@ namespace ime::priv {
         }
     }
 
+    void SceneManager::updateInput() {
+        if (scenes_.empty() || !scenes_.top()->isEntered() || engine_->isHeadless())
+            return;
+
+        Scene* activeScene = scenes_.top().get();
+        Scene* bgScene = activeScene->getBackgroundScene();
+
+        if (bgScene && activeScene->isBackgroundSceneUpdateEnabled())
+            bgScene->inputManager_.update();
+
+        activeScene->inputManager_.update();
+    }
+
     void SceneManager::updateScene(const Time& deltaTime, Scene* scene, bool fixedUpdate) {
-        if (!fixedUpdate) {
-            scene->inputManager_.update();
+        if (fixedUpdate)
+            saveInterpolationStates(scene);
+        else {
+            // When pipelined, the input is updated on the window thread (see updateInput)
+            if (!engine_->isHeadless() && !engine_->isRenderPipelined())
+                scene->inputManager_.update();
+
             scene->timerManager_.update(deltaTime * scene->getTimescale());
             scene->guiContainer_.update(deltaTime);
         }
@@ -523,18 +572,21 @@ namespace ime::priv {
 
     void SceneManager::updatePhysicsWorld(Scene *scene, const Time &deltaTime, bool fixedUpdate) {
         if (scene->hasPhysicsSim_) {
-            scene->internalEmitter_.emit("preStep", deltaTime * scene->getTimescale());
+            scene->internalEmitter_.emit(scenePreStepEvent, deltaTime * scene->getTimescale());
 
             /// This function is called by the engine for both fixed and normal
             /// update. The only way to know which is which is via @fixedUpdate
             /// flag (explains, this explains why the bodies of the if-else
             /// statement below are the same
             if (fixedUpdate && scene->world_->isFixedStep()) {
+                syncTransforms(scene);
                 scene->world_->update(deltaTime * scene->getTimescale());
-            } else if (!fixedUpdate && !scene->world_->isFixedStep())
+            } else if (!fixedUpdate && !scene->world_->isFixedStep()) {
+                syncTransforms(scene);
                 scene->world_->update(deltaTime * scene->getTimescale());
+            }
 
-            scene->internalEmitter_.emit("postStep", deltaTime * scene->getTimescale());
+            scene->internalEmitter_.emit(scenePostStepEvent, deltaTime * scene->getTimescale());
         }
     }
 
@@ -562,13 +614,31 @@ namespace ime::priv {
             scene->onUpdate(deltaTime * scene->getTimescale());
 
             // Emit internal post update
-            scene->internalEmitter_.emit("postUpdate", deltaTime * scene->getTimescale());
+            scene->internalEmitter_.emit(scenePostUpdateEvent, deltaTime * scene->getTimescale());
 
             // Normal update is always called after fixed update: fixedUpdate -> update -> postUpdate
             scene->onPostUpdate(deltaTime * scene->getTimescale());
         }
     }
 
+    void SceneManager::saveInterpolationStates(Scene *scene) {
+        scene->getGameObjects().forEachInterpolated([](GameObject* gameObject) {
+            gameObject->getTransform().savePreviousState();
+        });
+    }
+
+    void SceneManager::interpolateTransforms(Scene *scene, float alpha) {
+        scene->getGameObjects().forEachInterpolated([alpha](GameObject* gameObject) {
+            const Transform& transform = gameObject->getTransform();
+            gameObject->getSprite().setPosition(transform.getInterpolatedPosition(alpha));
+            gameObject->getSprite().setRotation(transform.getInterpolatedRotation(alpha));
+        });
+    }
+
+    void SceneManager::syncTransforms(Scene *scene) {
+        scene->getGameObjects().syncTransforms();
+    }
+
     SceneManager::~SceneManager() {
         prevScene_ = nullptr;
     }
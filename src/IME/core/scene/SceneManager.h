@@ -29,6 +29,7 @@
 #include "IME/core/time/Time.h"
 #include "IME/core/event/Event.h"
 #include "IME/core/scene/Scene.h"
+#include "IME/graphics/shapes/RectangleShape.h"
 #include <stack>
 #include <memory>
 #include <string>
@@ -238,6 +239,17 @@ namespace ime {
              */
             void render(priv::RenderTarget& window);
 
+            /**
+             * @brief Render the gui of the scenes rendered by render()
+             *
+             * This function is only needed when the scenes are rendered into
+             * a snapshot, since the gui cannot be recorded. Otherwise the gui
+             * is rendered together with its scene
+             *
+             * @see priv::RenderTarget::beginRecording
+             */
+            void renderGui();
+
             /**
              * @brief Update the scene manager
              * @param deltaTime Time passed since last update
@@ -259,6 +271,16 @@ namespace ime {
              */
             void fixedUpdate(Time deltaTime);
 
+            /**
+             * @brief Update the input of the current scene
+             *
+             * When rendering is pipelined, the scene is updated on a worker
+             * thread while input is polled on the window thread, so the
+             * engine calls this function before it dispatches the update.
+             * Otherwise the input is updated together with its scene
+             */
+            void updateInput();
+
             /**
              * @brief Handle a system event
              * @param event Event to be handled
@@ -308,11 +330,44 @@ namespace ime {
              */
             void updatePhysicsWorld(Scene* scene, const Time& deltaTime, bool fixedUpdate);
 
+            /**
+             * @brief Save the state of interpolated game objects before a
+             *        fixed update
+             * @param scene The scene whose game objects are to be saved
+             */
+            static void saveInterpolationStates(Scene* scene);
+
+            /**
+             * @brief Execute a callback for each scene that must be rendered
+             * @param callback The callback to be executed
+             *
+             * The scenes are passed in the order in which they are drawn
+             */
+            void forEachRenderedScene(const Callback<Scene*>& callback);
+
+            /**
+             * @brief Move the sprites of interpolated game objects between
+             *        their previous and current fixed update states
+             * @param scene The scene whose game objects are to be interpolated
+             * @param alpha The interpolation factor in the range [0, 1]
+             */
+            static void interpolateTransforms(Scene* scene, float alpha);
+
+            /**
+             * @brief Flush pending transform changes of game objects
+             * @param scene The scene whose game objects are to be synced
+             *
+             * This pushes the final state of deferred transforms to their
+             * sprites and rigid bodies, see ime::Transform::setDeferredSyncEnabled
+             */
+            static void syncTransforms(Scene* scene);
+
         private:
             Engine* engine_;                //!< Pointer to the game engine
             std::stack<Scene::Ptr> scenes_; //!< Scenes container
             Scene* prevScene_;              //!< Pointer to the active scene before a push operation
             std::unordered_map<std::string, Scene::Ptr> cachedScenes_;
+            RectangleShape camOutline_;     //!< Draws the outline of a camera
         };
     }
 }
@@ -252,7 +252,7 @@ namespace ime {
             return;
 
         pimpl_->setCenter(x, y);
-        emitChange(Property{"centre", Vector2f{x, y}});
+        emitChange("centre", Vector2f{x, y});
     }
 
     void Camera::setCenter(const Vector2f &centre) {
@@ -270,7 +270,7 @@ namespace ime {
             return;
 
         pimpl_->setSize(width, height);
-        emitChange(Property{"size", Vector2f{width, height}});
+        emitChange("size", Vector2f{width, height});
     }
 
     void Camera::setSize(const Vector2f &size) {
@@ -286,7 +286,7 @@ namespace ime {
             return;
 
         pimpl_->setRotation(angle);
-        emitChange(Property{"rotation", angle});
+        emitChange("rotation", angle);
     }
 
     float Camera::getRotation() const {
@@ -298,7 +298,7 @@ namespace ime {
             return;
 
         pimpl_->setViewport(viewport);
-        emitChange(Property{"viewport", viewport});
+        emitChange("viewport", viewport);
     }
 
     FloatRect Camera::getViewport() const {
@@ -410,7 +410,7 @@ namespace ime {
             return;
 
         pimpl_->setTargetFollowOffset(offset);
-        emitChange(Property{"targetFollowOffset", offset});
+        emitChange("targetFollowOffset", offset);
     }
 
     const Vector2f &Camera::getTargetFollowOffset() const {
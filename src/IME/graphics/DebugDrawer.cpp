@@ -60,7 +60,7 @@ namespace ime::priv {
         }
 
         CircleShape& createCircle(float radius, const b2Vec2& position, const b2Color& fillColour) {
-            static CircleShape circle{utility::metresToPixels(radius)};
+            thread_local CircleShape circle{utility::metresToPixels(radius)};
             circle.setOrigin(circle.getLocalBounds().width / 2.0f, circle.getLocalBounds().height / 2.0f);
             circle.setPosition(utility::metresToPixels({position.x, position.y}));
             circle.setFillColour(convertToOwnColour(fillColour));
@@ -72,7 +72,7 @@ namespace ime::priv {
         void drawPolygon(const b2Vec2 *vertices, int32 vertexCount, const b2Color &fillColour,
             const b2Color &outlineColour, RenderTarget& window)
         {
-            static ConvexShape polygon;
+            thread_local ConvexShape polygon;
             polygon.setPointCount(vertexCount);
 
             for (int32 i = 0; i < vertexCount; ++i)
@@ -120,7 +120,7 @@ namespace ime::priv {
             sf::Vertex({utility::metresToPixels(endPoint.x), utility::metresToPixels(endPoint.y)}, utility::convertToSFMLColour(convertToOwnColour(colour))),
         };
 
-        window_.getThirdPartyWindow().draw(line, 2, sf::Lines);
+        window_.submit(line, 2, sf::Lines);
     }
 
     void DebugDrawer::DrawTransform(const b2Transform &transform) {
@@ -137,7 +137,7 @@ namespace ime::priv {
         sf::Vertex p{sf::Vector2f{utility::metresToPixels(point.x), utility::metresToPixels(point.y)},
                             utility::convertToSFMLColour(convertToOwnColour(colour))};
 
-        window_.getThirdPartyWindow().draw(&p, 1, sf::Points);
+        window_.submit(&p, 1, sf::Points);
     }
 
     DebugDrawer::~DebugDrawer() = default;
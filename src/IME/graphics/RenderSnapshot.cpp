@@ -0,0 +1,137 @@
+////////////////////////////////////////////////////////////////////////////////
+// IME - Infinite Motion Engine
+//
+// Copyright (c) 2020-2022 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "IME/graphics/RenderSnapshot.h"
+
+#include <mutex>
+#include <unordered_map>
+
+namespace ime::priv {
+    namespace {
+        // The textures created by makeSharedTexture, a texture removes itself when it is destroyed
+        std::mutex sharedTexturesMutex;
+        std::unordered_map<const sf::Texture*, std::weak_ptr<const sf::Texture>> sharedTextures;
+    }
+
+    std::shared_ptr<sf::Texture> makeSharedTexture() {
+        std::shared_ptr<sf::Texture> texture{new sf::Texture(), [](sf::Texture* texture) {
+            {
+                std::scoped_lock lock(sharedTexturesMutex);
+                sharedTextures.erase(texture);
+            }
+
+            delete texture;
+        }};
+
+        std::scoped_lock lock(sharedTexturesMutex);
+        sharedTextures.emplace(texture.get(), texture);
+        return texture;
+    }
+
+    void RenderSnapshot::record(const sf::View &view) {
+        commands_.emplace_back(view);
+    }
+
+    void RenderSnapshot::record(const sf::Sprite &sprite) {
+        keepAlive(sprite.getTexture());
+        commands_.emplace_back(sprite);
+    }
+
+    void RenderSnapshot::record(const sf::Shape &shape) {
+        keepAlive(shape.getTexture());
+
+        const std::size_t firstPoint = points_.size();
+        const std::size_t pointCount = shape.getPointCount();
+        for (std::size_t i = 0; i < pointCount; ++i)
+            points_.push_back(shape.getPoint(i));
+
+        commands_.emplace_back(Shape{shape.getTransform(), shape.getTexture(), shape.getTextureRect(),
+            shape.getFillColor(), shape.getOutlineColor(), shape.getOutlineThickness(), firstPoint, pointCount});
+    }
+
+    void RenderSnapshot::record(const sf::Vertex *vertices, std::size_t vertexCount, sf::PrimitiveType type) {
+        commands_.emplace_back(Primitives{vertices_.size(), vertexCount, type});
+        vertices_.insert(vertices_.end(), vertices, vertices + vertexCount);
+    }
+
+    std::size_t RenderSnapshot::getCommandCount() const {
+        return commands_.size();
+    }
+
+    bool RenderSnapshot::isEmpty() const {
+        return commands_.empty();
+    }
+
+    void RenderSnapshot::clear() {
+        commands_.clear();
+        points_.clear();
+        vertices_.clear();
+
+        // May destroy textures, so it must not be done while sharedTexturesMutex is held
+        textures_.clear();
+    }
+
+    void RenderSnapshot::render(sf::RenderTarget &target) const {
+        const sf::View initialView = target.getView();
+
+        for (const auto& command : commands_) {
+            if (const auto* view = std::get_if<sf::View>(&command))
+                target.setView(*view);
+            else if (const auto* sprite = std::get_if<sf::Sprite>(&command))
+                target.draw(*sprite);
+            else if (const auto* shape = std::get_if<Shape>(&command)) {
+                shapeRenderer_.setTexture(shape->texture);
+                shapeRenderer_.setTextureRect(shape->textureRect);
+                shapeRenderer_.setFillColor(shape->fillColour);
+                shapeRenderer_.setOutlineColor(shape->outlineColour);
+                shapeRenderer_.setOutlineThickness(shape->outlineThickness);
+                shapeRenderer_.setPoints(points_.data() + shape->firstPoint, shape->pointCount);
+                target.draw(shapeRenderer_, sf::RenderStates(shape->transform));
+            } else if (const auto* primitives = std::get_if<Primitives>(&command))
+                target.draw(vertices_.data() + primitives->firstVertex, primitives->vertexCount, primitives->type);
+        }
+
+        target.setView(initialView);
+    }
+
+    void RenderSnapshot::keepAlive(const sf::Texture *texture) {
+        // Consecutive drawables usually share a texture, it only has to be kept alive once
+        if (!texture || (!textures_.empty() && textures_.back().get() == texture))
+            return;
+
+        std::shared_ptr<const sf::Texture> owner;
+        {
+            std::scoped_lock lock(sharedTexturesMutex);
+            if (auto found = sharedTextures.find(texture); found != sharedTextures.end())
+                owner = found->second.lock();
+        }
+
+        if (owner)
+            textures_.push_back(std::move(owner));
+    }
+
+    RenderSnapshot::~RenderSnapshot() {
+        clear();
+    }
+}
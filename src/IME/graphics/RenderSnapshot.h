@@ -0,0 +1,212 @@
+////////////////////////////////////////////////////////////////////////////////
+// IME - Infinite Motion Engine
+//
+// Copyright (c) 2020-2022 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef IME_RENDERSNAPSHOT_H
+#define IME_RENDERSNAPSHOT_H
+
+#include "IME/Config.h"
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/View.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Shape.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <memory>
+#include <variant>
+#include <vector>
+
+namespace ime::priv {
+    /**
+     * @brief A copy of the draw calls of a single frame
+     *
+     * The snapshot stores the draw calls in the order in which they were
+     * submitted, together with the view changes between them. This allows
+     * the frame to be drawn at a later time (and on a different thread)
+     * from the one in which it was recorded, while the objects it was
+     * recorded from continue to be modified.
+     *
+     * Sprites and views are stored by value. Shapes are stored as their
+     * transform, colours and points, and primitives as their vertices. The
+     * points and vertices of all the commands share buffers that are reused
+     * by the next frame, such that recording does not allocate once the
+     * buffers are large enough
+     *
+     * Sprites and shapes store a pointer to their texture. A texture that
+     * was created by makeSharedTexture() is kept alive by the snapshots that
+     * reference it until they are cleared, any other texture must outlive
+     * the snapshots that reference it
+     */
+    class RenderSnapshot {
+    public:
+        /**
+         * @brief Default constructor
+         */
+        RenderSnapshot() = default;
+
+        RenderSnapshot(const RenderSnapshot&) = delete;
+        RenderSnapshot& operator=(const RenderSnapshot&) = delete;
+
+        /**
+         * @brief Record a view change
+         * @param view The view subsequent drawables are drawn in
+         */
+        void record(const sf::View& view);
+
+        /**
+         * @brief Record a sprite
+         * @param sprite The sprite to be recorded
+         */
+        void record(const sf::Sprite& sprite);
+
+        /**
+         * @brief Record a shape
+         * @param shape The shape to be recorded
+         */
+        void record(const sf::Shape& shape);
+
+        /**
+         * @brief Record primitives defined by an array of vertices
+         * @param vertices Pointer to the vertices
+         * @param vertexCount Number of vertices in the array
+         * @param type Type of primitives to draw
+         */
+        void record(const sf::Vertex* vertices, std::size_t vertexCount, sf::PrimitiveType type);
+
+        /**
+         * @brief Get the number of recorded commands
+         * @return The number of recorded commands
+         */
+        std::size_t getCommandCount() const;
+
+        /**
+         * @brief Check if the snapshot has recorded commands
+         * @return True if nothing is recorded, otherwise false
+         */
+        bool isEmpty() const;
+
+        /**
+         * @brief Remove all recorded commands
+         *
+         * The memory used by the commands is retained such that the
+         * snapshot can be reused by the next frame without reallocating
+         */
+        void clear();
+
+        /**
+         * @brief Draw the recorded commands on a render target
+         * @param target The target to draw on
+         *
+         * The view of @a target is restored after drawing
+         */
+        void render(sf::RenderTarget& target) const;
+
+        /**
+         * @brief Destructor
+         */
+        ~RenderSnapshot();
+
+    private:
+        /**
+         * @brief A recorded shape
+         */
+        struct Shape {
+            sf::Transform transform;    //!< The transform of the shape
+            const sf::Texture* texture; //!< The texture of the shape
+            sf::IntRect textureRect;    //!< The part of the texture the shape displays
+            sf::Color fillColour;       //!< The fill colour of the shape
+            sf::Color outlineColour;    //!< The outline colour of the shape
+            float outlineThickness;     //!< The outline thickness of the shape
+            std::size_t firstPoint;     //!< The index of the first point of the shape in the points buffer
+            std::size_t pointCount;     //!< The number of points of the shape
+        };
+
+        /**
+         * @brief Primitives defined by an array of vertices
+         */
+        struct Primitives {
+            std::size_t firstVertex;  //!< The index of the first vertex in the vertices buffer
+            std::size_t vertexCount;  //!< The number of vertices of the primitives
+            sf::PrimitiveType type;   //!< The type of the primitives
+        };
+
+        /**
+         * @brief Draws recorded shapes
+         *
+         * The geometry of the shape is computed from the points buffer when
+         * it is drawn, its vertex arrays are reused by every recorded shape
+         */
+        class ShapeRenderer : public sf::Shape {
+        public:
+            /**
+             * @brief Set the points of the shape
+             * @param points The points of the shape
+             * @param pointCount The number of points
+             */
+            void setPoints(const sf::Vector2f* points, std::size_t pointCount) {
+                points_ = points;
+                pointCount_ = pointCount;
+                update();
+            }
+
+            std::size_t getPointCount() const override { return pointCount_; }
+            sf::Vector2f getPoint(std::size_t index) const override { return points_[index]; }
+
+        private:
+            const sf::Vector2f* points_ = nullptr; //!< The points of the shape
+            std::size_t pointCount_ = 0;           //!< The number of points
+        };
+
+        /**
+         * @brief Keep a texture referenced by a recorded command alive
+         * @param texture The texture to be kept alive
+         *
+         * The texture is released when the snapshot is cleared. This
+         * function does nothing if @a texture was not created by
+         * makeSharedTexture()
+         */
+        void keepAlive(const sf::Texture* texture);
+
+        using Command = std::variant<sf::View, sf::Sprite, Shape, Primitives>;
+
+        std::vector<Command> commands_;        //!< Recorded draw commands
+        std::vector<sf::Vector2f> points_;     //!< The points of the recorded shapes
+        std::vector<sf::Vertex> vertices_;     //!< The vertices of the recorded primitives
+        mutable ShapeRenderer shapeRenderer_;  //!< Draws the recorded shapes
+        std::vector<std::shared_ptr<const sf::Texture>> textures_; //!< Textures referenced by the recorded commands
+    };
+
+    /**
+     * @brief Create a texture that recorded snapshots can keep alive
+     * @return The created texture
+     *
+     * A pipelined frame is drawn one frame after it was recorded, by then
+     * the texture of a recorded drawable may have been released by its
+     * owner. Snapshots share the ownership of the textures created by this
+     * function, such that they are only destroyed once they are no longer
+     * drawn
+     */
+    std::shared_ptr<sf::Texture> makeSharedTexture();
+}
+
+#endif // IME_RENDERSNAPSHOT_H
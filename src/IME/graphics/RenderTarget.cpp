@@ -28,15 +28,9 @@
 #include <SFML/Window/Event.hpp>
 
 namespace ime::priv {
-    bool RenderTarget::isInstantiated_{false};
-
-    RenderTarget::RenderTarget() {
-        IME_ASSERT(!isInstantiated_, "Only a single instance of ime::Window can be instantiated")
-        isInstantiated_ = true;
-    }
-
     void RenderTarget::create(const std::string& title, unsigned int width, unsigned int height, Uint32 style) {
         title_ = title;
+        windowThread_ = std::this_thread::get_id();
         window_.create(sf::VideoMode(width, height), title, static_cast<sf::Uint32>(style));
 
         if (!icon_.empty())
@@ -85,6 +79,7 @@ namespace ime::priv {
     }
 
     bool RenderTarget::pollEvent(Event& event) {
+        IME_ASSERT(isWindowThread(), windowThreadError)
         sf::Event sfmlEvent;
         bool eventPopped = window_.pollEvent(sfmlEvent);
 
@@ -95,10 +90,12 @@ namespace ime::priv {
     }
 
     void RenderTarget::close() {
+        IME_ASSERT(isWindowThread(), windowThreadError)
         window_.close();
     }
 
     void RenderTarget::draw(const sf::Drawable &drawable) {
+        IME_ASSERT(isWindowThread(), windowThreadError)
         window_.draw(drawable);
     }
 
@@ -106,11 +103,48 @@ namespace ime::priv {
         drawable.draw(*this);
     }
 
+    void RenderTarget::submit(const sf::Vertex *vertices, std::size_t vertexCount, sf::PrimitiveType type) {
+        if (snapshot_)
+            snapshot_->record(vertices, vertexCount, type);
+        else {
+            IME_ASSERT(isWindowThread(), windowThreadError)
+            window_.draw(vertices, vertexCount, type);
+        }
+    }
+
+    void RenderTarget::setView(const sf::View &view) {
+        if (snapshot_)
+            snapshot_->record(view);
+        else {
+            IME_ASSERT(isWindowThread(), windowThreadError)
+            window_.setView(view);
+        }
+    }
+
+    void RenderTarget::beginRecording(RenderSnapshot &snapshot) {
+        snapshot_ = &snapshot;
+    }
+
+    void RenderTarget::endRecording() {
+        snapshot_ = nullptr;
+    }
+
+    bool RenderTarget::isRecording() const {
+        return snapshot_ != nullptr;
+    }
+
+    void RenderTarget::draw(const RenderSnapshot &snapshot) {
+        IME_ASSERT(isWindowThread(), windowThreadError)
+        snapshot.render(window_);
+    }
+
     void RenderTarget::clear(Colour colour) {
+        IME_ASSERT(isWindowThread(), windowThreadError)
         window_.clear(utility::convertToSFMLColour(colour));
     }
 
     void RenderTarget::display() {
+        IME_ASSERT(isWindowThread(), windowThreadError)
         window_.display();
     }
 
@@ -125,8 +159,4 @@ namespace ime::priv {
     void RenderTarget::onCreate(Callback<> callback) {
         onCreate_ = std::move(callback);
     }
-
-    RenderTarget::~RenderTarget() {
-        isInstantiated_ = false;
-    }
 }
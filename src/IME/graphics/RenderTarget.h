@@ -30,8 +30,10 @@
 #include "IME/graphics/Drawable.h"
 #include "IME/graphics/Colour.h"
 #include "IME/graphics/WindowStyles.h"
+#include "IME/graphics/RenderSnapshot.h"
 #include <SFML/Graphics/RenderWindow.hpp>
 #include <string>
+#include <thread>
 
 namespace ime::priv {
     /**
@@ -48,11 +50,10 @@ namespace ime::priv {
         /**
          * @brief Constructor
          *
-         * @warning Only a single instance of the class can exist at a time.
-         * Attempting to instantiate the class while there is an active
-         * instance will terminate the program
+         * Each engine owns its own render target, therefore multiple
+         * instances may exist at the same time
          */
-        RenderTarget();
+        RenderTarget() = default;
 
         /**
          * @brief Copy constructor
@@ -152,6 +153,78 @@ namespace ime::priv {
          */
         void draw(const Drawable& drawable);
 
+        /**
+         * @brief Draw a third party drawable on the window
+         * @param drawable Object to be drawn
+         *
+         * If the render target is recording, @a drawable is copied into
+         * the snapshot being recorded instead of being drawn
+         *
+         * @see beginRecording
+         */
+        template <typename T>
+        void submit(const T& drawable) {
+            if (snapshot_)
+                snapshot_->record(drawable);
+            else {
+                IME_ASSERT(isWindowThread(), windowThreadError)
+                window_.draw(drawable);
+            }
+        }
+
+        /**
+         * @brief Draw primitives defined by an array of vertices
+         * @param vertices Pointer to the vertices
+         * @param vertexCount Number of vertices in the array
+         * @param type Type of primitives to draw
+         *
+         * If the render target is recording, the vertices are copied into
+         * the snapshot being recorded instead of being drawn
+         *
+         * @see beginRecording
+         */
+        void submit(const sf::Vertex* vertices, std::size_t vertexCount, sf::PrimitiveType type);
+
+        /**
+         * @brief Set the view in which subsequent drawables are drawn
+         * @param view The new view
+         *
+         * If the render target is recording, the view change is recorded
+         * in the snapshot instead of being applied to the window
+         */
+        void setView(const sf::View& view);
+
+        /**
+         * @brief Start recording submitted drawables into a snapshot
+         * @param snapshot The snapshot to record into
+         *
+         * While recording, nothing is drawn on the window, therefore
+         * drawables may be submitted from a thread other than the one
+         * that owns the window
+         *
+         * @see endRecording
+         */
+        void beginRecording(RenderSnapshot& snapshot);
+
+        /**
+         * @brief Stop recording submitted drawables
+         *
+         * @see beginRecording
+         */
+        void endRecording();
+
+        /**
+         * @brief Check if the render target is recording
+         * @return True if recording, otherwise false
+         */
+        bool isRecording() const;
+
+        /**
+         * @brief Draw a recorded snapshot on the window
+         * @param snapshot The snapshot to be drawn
+         */
+        void draw(const RenderSnapshot& snapshot);
+
         /**
          * @brief Clear the entire window with a single colour
          * @param colour Colour to clear window with
@@ -179,20 +252,26 @@ namespace ime::priv {
          */
         void onCreate(Callback<> callback);
 
+    private:
         /**
-         * @brief Destructor
-         *
-         * Ensures a new Window instance can be created when an existing
-         * Window instance is destroyed
+         * @brief Check if the calling thread may use the window
+         * @return True if the calling thread created the window or if the
+         *         window has not been created yet, otherwise false
          */
-        ~RenderTarget();
+        bool isWindowThread() const {
+            return windowThread_ == std::thread::id() || windowThread_ == std::this_thread::get_id();
+        }
+
+        static constexpr const char* windowThreadError = "The window can only be used by the thread that created it. "
+            "When rendering is pipelined, render callbacks run on a worker thread and must not draw on the window directly";
 
     private:
         sf::RenderWindow window_;      //!< Render window
         std::string icon_;             //!< The icon of the window
         std::string title_;            //!< The title of the window
-        static bool isInstantiated_;   //!< Instantiation state
         Callback<> onCreate_;
+        RenderSnapshot* snapshot_ = nullptr; //!< The snapshot being recorded
+        std::thread::id windowThread_;       //!< The thread that created the window
     };
 }
 
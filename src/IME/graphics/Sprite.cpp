@@ -142,7 +142,7 @@ namespace ime {
 
         void draw(priv::RenderTarget &renderTarget) const {
             if (isVisible_)
-                renderTarget.getThirdPartyWindow().draw(sprite_);
+                renderTarget.submit(sprite_);
         }
 
         void setColour(Colour colour) {
@@ -306,7 +306,7 @@ namespace ime {
             return;
 
         pImpl_->setTextureRect(left, top, width, height);
-        emitChange(Property{"textureRect", getTextureRect()});
+        emitChange("textureRect", getTextureRect());
     }
 
     UIntRect Sprite::getTextureRect() const {
@@ -320,7 +320,7 @@ namespace ime {
             return;
 
         pImpl_->setPosition(x, y);
-        emitChange(Property{"position", Vector2f{x, y}});
+        emitChange("position", Vector2f{x, y});
     }
 
     void Sprite::setPosition(const Vector2f& position) {
@@ -332,7 +332,7 @@ namespace ime {
             return;
 
         pImpl_->setRotation(angle);
-        emitChange(Property{"rotation", angle});
+        emitChange("rotation", angle);
     }
 
     void Sprite::setScale(float factorX, float factorY) {
@@ -340,7 +340,7 @@ namespace ime {
             return;
 
         pImpl_->setScale(factorX, factorY);
-        emitChange(Property{"scale", Vector2f{factorX, factorY}});
+        emitChange("scale", Vector2f{factorX, factorY});
     }
 
     void Sprite::setScale(const Vector2f& scale) {
@@ -392,7 +392,7 @@ namespace ime {
             return;
 
         pImpl_->setColour(colour);
-        emitChange(Property{"colour", colour});
+        emitChange("colour", colour);
     }
 
     Colour Sprite::getColour() const {
@@ -404,7 +404,7 @@ namespace ime {
             return;
 
         pImpl_->setOpacity(opacity);
-        emitChange(Property{"opacity", opacity});
+        emitChange("opacity", opacity);
     }
 
     unsigned int Sprite::getOpacity() const {
@@ -416,7 +416,7 @@ namespace ime {
             return;
 
         pImpl_->setVisible(visible);
-        emitChange(Property{"visible", visible});
+        emitChange("visible", visible);
     }
 
     bool Sprite::isVisible() const {
@@ -434,7 +434,7 @@ namespace ime {
             return;
 
         pImpl_->setOrigin(x, y);
-        emitChange(Property{"origin", Vector2f{x, y}});
+        emitChange("origin", Vector2f{x, y});
     }
 
     Vector2f Sprite::getOrigin() const {
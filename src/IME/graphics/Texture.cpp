@@ -30,13 +30,13 @@
 namespace ime {
     struct Texture::Impl {
         Impl() :
-            texture_{std::make_shared<sf::Texture>()},
+            texture_{priv::makeSharedTexture()},
             image_{nullptr}
         {}
 
         Impl(const std::string &filename, const UIntRect &area) :
             filename_{filename},
-            texture_{std::make_shared<sf::Texture>()},
+            texture_{priv::makeSharedTexture()},
             image_{nullptr}
         {
             loadFromFile(filename, area);
@@ -99,7 +99,7 @@ namespace ime {
         if (tile_.hasRigidBody())
             tile_.getRigidBody()->setPosition(getWorldCentre());
 
-        emitChange(Property{Property{"position", getPosition()}});
+        emitChange("position", getPosition());
     }
 
     void Tile::setPosition(Vector2f position) {
@@ -132,7 +132,7 @@ namespace ime {
             });
         }
 
-        emitChange(Property{"size", getSize()});
+        emitChange("size", getSize());
     }
 
     void Tile::setSize(Vector2u size) {
@@ -148,13 +148,13 @@ namespace ime {
         if (tile_.hasRigidBody())
             tile_.getRigidBody()->setEnabled(collidable);
 
-        emitChange(Property{"collidable", isCollidable_});
+        emitChange("collidable", isCollidable_);
     }
 
     void Tile::setId(char id) {
         if (id_ != id) {
             id_ = id;
-            emitChange(Property{"id", id_});
+            emitChange("id", id_);
         }
     }
 
@@ -177,7 +177,7 @@ namespace ime {
             tile_.setFillColour(Colour::Transparent);
         }
 
-        emitChange(Property{"visible", isVisible()});
+        emitChange("visible", isVisible());
     }
 
     bool Tile::isVisible() const {
@@ -208,7 +208,7 @@ namespace ime {
     void Tile::setIndex(Index index) {
         if (index_ != index) {
             index_ = index;
-            emitChange(Property{"index", index_});
+            emitChange("index", index_);
         }
     }
 
@@ -219,7 +219,7 @@ namespace ime {
     void Tile::setFillColour(const Colour &colour) {
         if (tile_.getFillColour() != colour) {
             tile_.setFillColour(colour);
-            emitChange(Property{"fillColour", tile_.getFillColour()});
+            emitChange("fillColour", tile_.getFillColour());
         }
     }
 
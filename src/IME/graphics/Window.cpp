@@ -39,6 +39,7 @@ namespace ime {
         isVisible_{false},
         isCursorVisible_{false},
         isCursorGrabbed_{false},
+        isPacedByEngine_{false},
         clearColour_{ime::Colour::Black},
         defaultWinCloseHandlerId_{-1}
     {
@@ -206,7 +207,9 @@ namespace ime {
             throw InvalidArgumentException("The frame rate limit of ime::Window must be greater than 0");
 
         frameRateLimit_ = limit;
-        renderTarget_.getThirdPartyWindow().setFramerateLimit(limit);
+
+        if (!isPacedByEngine_)
+            renderTarget_.getThirdPartyWindow().setFramerateLimit(limit);
     }
 
     unsigned int Window::getFrameRateLimit() const {
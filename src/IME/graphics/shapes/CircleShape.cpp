@@ -85,7 +85,7 @@ namespace ime {
             return;
 
         pimpl_->circle_->setRadius(radius);
-        emitChange(Property{"radius", radius});
+        emitChange("radius", radius);
     }
 
     float CircleShape::getRadius() const {
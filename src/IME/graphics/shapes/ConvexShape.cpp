@@ -84,7 +84,7 @@ namespace ime {
             return;
 
         pimpl_->polygon_->setPointCount(count);
-        emitChange(Property{"pointCount", count});
+        emitChange("pointCount", count);
     }
 
     std::size_t ConvexShape::getPointCount() const {
@@ -97,7 +97,7 @@ namespace ime {
 
         IME_ASSERT(index <= getPointCount() - 1, "Index out of bounds")
         pimpl_->polygon_->setPoint(index, {point.x, point.y});
-        emitChange(Property{"point", index});
+        emitChange("point", index);
     }
 
     Vector2f ConvexShape::getPoint(std::size_t index) const {
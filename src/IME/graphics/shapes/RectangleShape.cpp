@@ -84,7 +84,7 @@ namespace ime {
             return;
 
         pimpl_->rectangle_->setSize({size.x, size.y});
-        emitChange(Property{"size", size});
+        emitChange("size", size);
     }
 
     Vector2f RectangleShape::getSize() const {
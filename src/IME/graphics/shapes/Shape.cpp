@@ -164,7 +164,7 @@ namespace ime {
             return;
 
         pimpl_->setFillColour(colour);
-        emitChange(Property{"fillColour", colour});
+        emitChange("fillColour", colour);
     }
 
     Colour Shape::getFillColour() const {
@@ -176,7 +176,7 @@ namespace ime {
             return;
 
         pimpl_->setOutlineColour(colour);
-        emitChange(Property{"outlineColour", colour});
+        emitChange("outlineColour", colour);
     }
 
     Colour Shape::getOutlineColour() const {
@@ -188,7 +188,7 @@ namespace ime {
             return;
 
         pimpl_->setOutlineThickness(thickness);
-        emitChange(Property{"outlineThickness", thickness});
+        emitChange("outlineThickness", thickness);
     }
 
     float Shape::getOutlineThickness() const {
@@ -210,7 +210,7 @@ namespace ime {
             return;
 
         pimpl_->setPosition(x, y);
-        emitChange(Property{"position", getPosition()});
+        emitChange("position", getPosition());
     }
 
     void Shape::setPosition(const Vector2f& position) {
@@ -226,7 +226,7 @@ namespace ime {
             return;
 
         pimpl_->setRotation(angle);
-        emitChange(Property{"rotation", angle});
+        emitChange("rotation", angle);
     }
 
     void Shape::rotate(float angle) {
@@ -243,7 +243,7 @@ namespace ime {
             return;
 
         pimpl_->setScale(factorX, factorY);
-        emitChange(Property{"scale", getScale()});
+        emitChange("scale", getScale());
     }
 
     void Shape::setScale(const Vector2f& scale) {
@@ -269,7 +269,7 @@ namespace ime {
             return;
 
         pimpl_->setOrigin(x, y);
-        emitChange(Property{"origin", getOrigin()});
+        emitChange("origin", getOrigin());
     }
 
     void Shape::setOrigin(const Vector2f& origin) {
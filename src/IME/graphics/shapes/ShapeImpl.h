@@ -393,7 +393,7 @@ namespace ime {
             }
 
             void draw(priv::RenderTarget &renderTarget) const override {
-                renderTarget.getThirdPartyWindow().draw(*shape_);
+                renderTarget.submit(*shape_);
             }
 
             std::shared_ptr<sf::Shape> getInternalPtr() override {
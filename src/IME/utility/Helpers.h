@@ -258,7 +258,7 @@ namespace ime {
          * @return The event listeners identification number
          */
         template<typename ...Args>
-        int addEventListener(EventEmitter& emitter, const std::string& name,
+        int addEventListener(EventEmitter& emitter, const EventKey& name,
             const Callback<Args...>& callback, bool oneTime);
 
         #include "Helpers.inl"
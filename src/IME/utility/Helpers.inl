@@ -53,7 +53,7 @@ bool eraseIn(std::vector<T>& vector, const U& element) {
 }
 
 template<typename ...Args>
-int addEventListener(EventEmitter& emitter, const std::string& name, const Callback<Args...>& callback, bool oneTime) {
+int addEventListener(EventEmitter& emitter, const EventKey& name, const Callback<Args...>& callback, bool oneTime) {
     if (oneTime)
         return emitter.addOnceEventListener(name, callback);
     else
@@ -37,7 +37,7 @@ namespace ime {
         }
     
         Colour generateRandomColour() {
-            static auto gen_random_num_between_0_and_255 = createRandomNumGenerator(0, 255);
+            thread_local auto gen_random_num_between_0_and_255 = createRandomNumGenerator(0, 255);
             return {static_cast<unsigned int>(gen_random_num_between_0_and_255()),
                     static_cast<unsigned int>(gen_random_num_between_0_and_255()),
                     static_cast<unsigned int>(gen_random_num_between_0_and_255())};
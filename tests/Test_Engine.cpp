@@ -0,0 +1,99 @@
+////////////////////////////////////////////////////////////////////////////////
+// IME - Infinite Motion Engine
+//
+// Copyright (c) 2020-2022 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "IME/core/engine/Engine.h"
+#include "IME/core/scene/Scene.h"
+#include <doctest.h>
+#include <memory>
+
+namespace {
+    struct FrameCounts {
+        unsigned int updates = 0;
+        unsigned int fixedUpdates = 0;
+        ime::Time lastDeltaTime;
+    };
+
+    class FrameCountingScene : public ime::Scene {
+    public:
+        FrameCountingScene(unsigned int maxFrames, FrameCounts& counts) :
+            maxFrames_{maxFrames},
+            counts_{counts}
+        {}
+
+        void onFixedUpdate(ime::Time deltaTime) override {
+            IME_UNUSED(deltaTime);
+            counts_.fixedUpdates++;
+        }
+
+        void onUpdate(ime::Time deltaTime) override {
+            counts_.lastDeltaTime = deltaTime;
+
+            if (++counts_.updates >= maxFrames_)
+                getEngine().quit();
+        }
+
+    private:
+        unsigned int maxFrames_;
+        FrameCounts& counts_;
+    };
+
+    ime::PrefContainer createHeadlessSettings() {
+        ime::PrefContainer settings;
+        settings.addPref(ime::Preference("HEADLESS", ime::PrefType::Bool, true));
+        return settings;
+    }
+}
+
+TEST_CASE("ime::Engine class")
+{
+    SUBCASE("Headless mode")
+    {
+        SUBCASE("A headless engine runs without a window")
+        {
+            ime::Engine engine("Headless", createHeadlessSettings());
+            engine.initialize();
+
+            CHECK(engine.isHeadless());
+            CHECK_FALSE(engine.isRenderPipelined());
+        }
+
+        SUBCASE("A headless engine calls update and fixed update every frame")
+        {
+            const unsigned int frameCount = 10;
+            FrameCounts counts;
+
+            ime::Engine engine("Headless", createHeadlessSettings());
+            engine.setPhysicsUpdateFrameRate(50);
+            engine.setFixedDeltaTime(ime::milliseconds(40));
+            engine.initialize();
+            engine.pushScene(std::make_unique<FrameCountingScene>(frameCount, counts));
+            engine.run();
+
+            CHECK_EQ(counts.updates, frameCount);
+            CHECK_EQ(counts.fixedUpdates, 2 * frameCount);
+            CHECK_EQ(counts.lastDeltaTime, ime::milliseconds(40));
+            CHECK_EQ(engine.getFrameProfiler().getLastFrame().fixedUpdates, 2);
+        }
+    }
+}
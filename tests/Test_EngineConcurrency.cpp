@@ -0,0 +1,356 @@
+////////////////////////////////////////////////////////////////////////////////
+// IME - Infinite Motion Engine
+//
+// Copyright (c) 2020-2022 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "IME/core/engine/Engine.h"
+#include "IME/core/scene/Scene.h"
+#include "IME/core/event/EventDispatcher.h"
+#include "IME/core/object/GridObject.h"
+#include "IME/core/physics/grid/RandomGridMover.h"
+#include "IME/core/resources/ResourceLoader.h"
+#include "IME/core/input/Keyboard.h"
+#include <doctest.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <thread>
+#include <vector>
+#include <memory>
+#include <string>
+
+namespace {
+    class CountingScene : public ime::Scene {
+    public:
+        CountingScene(unsigned int maxFrames, unsigned int& frameCount) :
+            maxFrames_{maxFrames},
+            frameCount_{frameCount}
+        {}
+
+        void onUpdate(ime::Time deltaTime) override {
+            IME_UNUSED(deltaTime);
+            if (++frameCount_ >= maxFrames_)
+                getEngine().quit();
+        }
+
+    private:
+        unsigned int maxFrames_;
+        unsigned int& frameCount_;
+    };
+
+    class PostingScene : public ime::Scene {
+    public:
+        explicit PostingScene(unsigned int maxFrames) :
+            maxFrames_{maxFrames},
+            frameCount_{0}
+        {}
+
+        void onUpdate(ime::Time deltaTime) override {
+            IME_UNUSED(deltaTime);
+
+            // Posted from the engine thread and from a job, both must be dispatched on the engine thread
+            std::thread::id engineThread = std::this_thread::get_id();
+            ime::EventDispatcher::instance()->post("EngineConcurrency_post", engineThread);
+            getJobSystem().schedule([engineThread] {
+                ime::EventDispatcher::instance()->post("EngineConcurrency_post", engineThread);
+            });
+
+            if (++frameCount_ >= maxFrames_)
+                getEngine().quit();
+        }
+
+    private:
+        unsigned int maxFrames_;
+        unsigned int frameCount_;
+    };
+
+    class EmittingScene : public ime::Scene {
+    public:
+        EmittingScene(const std::string& event, unsigned int maxFrames) :
+            event_{event},
+            maxFrames_{maxFrames},
+            frameCount_{0}
+        {}
+
+        void onUpdate(ime::Time deltaTime) override {
+            IME_UNUSED(deltaTime);
+            emitter_.emit(event_);
+
+            if (++frameCount_ >= maxFrames_)
+                getEngine().quit();
+        }
+
+    private:
+        ime::EventEmitter emitter_;
+        std::string event_;
+        unsigned int maxFrames_;
+        unsigned int frameCount_;
+    };
+
+    const std::string imageFile = "Test_EngineConcurrency.bmp";
+
+    // Write a 1x1 24-bit bitmap that the engines can load concurrently
+    void writeImageFile() {
+        const unsigned char bitmap[] = {
+            'B', 'M', 58, 0, 0, 0, 0, 0, 0, 0, 54, 0, 0, 0,     // File header
+            40, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 24, 0,   // Info header
+            0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            255, 0, 0, 0                                        // Pixel data
+        };
+
+        std::ofstream output(imageFile, std::ios::binary | std::ios::trunc);
+        output.write(reinterpret_cast<const char*>(bitmap), sizeof(bitmap));
+    }
+
+    struct WorkloadResult {
+        unsigned int frameCount = 0;
+        unsigned int timerFireCount = 0;
+        unsigned int moveCount = 0;
+        unsigned int failedKeyLookups = 0;
+        unsigned int failedImageLoads = 0;
+        std::atomic<unsigned int> jobImageLoads{0};
+        std::vector<unsigned int> objectIds;
+    };
+
+    // Drives the engine state that is shared between engines: object id
+    // counters, the grid mover random number generator, the keyboard key
+    // table and the resource manager
+    class WorkloadScene : public ime::Scene {
+    public:
+        WorkloadScene(unsigned int maxFrames, WorkloadResult& result) :
+            maxFrames_{maxFrames},
+            result_{result},
+            lastObjectId_{0}
+        {}
+
+        void onEnter() override {
+            getTimer().setInterval(ime::milliseconds(16), [this] {
+                result_.timerFireCount++;
+            });
+
+            createGrid2D(32, 32);
+            getGrid().construct(ime::Vector2u{8, 8}, '.');
+
+            for (int i = 0; i < 4; ++i) {
+                auto actor = ime::GridObject::create(*this);
+                actor->setSpeed(ime::Vector2f{256.0f, 256.0f});
+                result_.objectIds.push_back(actor->getObjectId());
+                getGrid().addChild(actor.get(), ime::Index{i * 2, i * 2});
+
+                auto mover = ime::RandomGridMover::create(getGrid(), actor.get());
+                mover->onMoveEnd(ime::Callback<ime::Index>([this](ime::Index) {
+                    result_.moveCount++;
+                }));
+                mover->startMovement();
+
+                getGameObjects().add(std::move(actor));
+                getGridMovers().addObject(std::move(mover));
+            }
+        }
+
+        void onUpdate(ime::Time deltaTime) override {
+            IME_UNUSED(deltaTime);
+
+            // Replace the game object created in the previous frame
+            if (lastObjectId_ != 0)
+                getGameObjects().removeById(lastObjectId_);
+
+            auto object = ime::GameObject::create(*this);
+            lastObjectId_ = object->getObjectId();
+            result_.objectIds.push_back(lastObjectId_);
+            getGameObjects().add(std::move(object));
+
+            if (ime::input::Keyboard::keyToString(ime::input::Keyboard::stringToKey("Space")) != "Space")
+                result_.failedKeyLookups++;
+
+            if (!ime::ResourceLoader::loadFromFile(ime::ResourceType::Image, imageFile))
+                result_.failedImageLoads++;
+
+            WorkloadResult& result = result_;
+            getJobSystem().schedule([&result] {
+                if (ime::ResourceLoader::loadFromFile(ime::ResourceType::Image, imageFile))
+                    result.jobImageLoads++;
+            });
+
+            if (++result_.frameCount >= maxFrames_)
+                getEngine().quit();
+        }
+
+    private:
+        unsigned int maxFrames_;
+        WorkloadResult& result_;
+        unsigned int lastObjectId_;
+    };
+}
+
+TEST_CASE("Multiple headless engines can run concurrently")
+{
+    const unsigned int engineCount = 4;
+    const unsigned int framesPerEngine = 100;
+    std::vector<unsigned int> frameCounts(engineCount, 0);
+    std::vector<std::thread> threads;
+
+    for (auto i = 0u; i < engineCount; ++i) {
+        threads.emplace_back([i, framesPerEngine, &frameCounts] {
+            ime::PrefContainer settings;
+            settings.addPref(ime::Preference("HEADLESS", ime::PrefType::Bool, true));
+
+            ime::Engine engine("Engine " + std::to_string(i), settings);
+            engine.setFixedDeltaTime(ime::milliseconds(16));
+            engine.initialize();
+            engine.pushScene(std::make_unique<CountingScene>(framesPerEngine, frameCounts[i]));
+            engine.run();
+        });
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+
+    for (auto frameCount : frameCounts)
+        CHECK_EQ(frameCount, framesPerEngine);
+}
+
+TEST_CASE("Concurrent engines can share the engine wide state")
+{
+    const unsigned int engineCount = 4;
+    const unsigned int framesPerEngine = 100;
+    std::vector<WorkloadResult> results(engineCount);
+    std::vector<std::thread> threads;
+
+    writeImageFile();
+    const std::string imagePath = ime::ResourceLoader::getPath(ime::ResourceType::Image);
+    ime::ResourceLoader::setPath(ime::ResourceType::Image, "");
+
+    for (auto i = 0u; i < engineCount; ++i) {
+        threads.emplace_back([i, framesPerEngine, &results] {
+            ime::PrefContainer settings;
+            settings.addPref(ime::Preference("HEADLESS", ime::PrefType::Bool, true));
+
+            ime::Engine engine("Engine " + std::to_string(i), settings);
+            engine.setFixedDeltaTime(ime::milliseconds(16));
+            engine.initialize();
+            engine.pushScene(std::make_unique<WorkloadScene>(framesPerEngine, results[i]));
+            engine.run();
+        });
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+
+    ime::ResourceLoader::unload(ime::ResourceType::Image, imageFile);
+    ime::ResourceLoader::setPath(ime::ResourceType::Image, imagePath);
+    std::remove(imageFile.c_str());
+
+    std::vector<unsigned int> objectIds;
+    for (const auto& result : results) {
+        CHECK_EQ(result.frameCount, framesPerEngine);
+        CHECK(result.timerFireCount > 0);
+        CHECK(result.moveCount > 0);
+        CHECK_EQ(result.failedKeyLookups, 0u);
+        CHECK_EQ(result.failedImageLoads, 0u);
+        CHECK(result.jobImageLoads.load() > 0);
+        objectIds.insert(objectIds.end(), result.objectIds.begin(), result.objectIds.end());
+    }
+
+    // Object ids are unique across engines
+    std::sort(objectIds.begin(), objectIds.end());
+    CHECK(std::adjacent_find(objectIds.begin(), objectIds.end()) == objectIds.end());
+}
+
+TEST_CASE("Events posted by an engine are dispatched on the thread of that engine")
+{
+    const unsigned int engineCount = 4;
+    std::atomic<int> dispatchedCount{0};
+    std::atomic<int> misroutedCount{0};
+
+    auto dispatcher = ime::EventDispatcher::instance();
+    int listenerId = dispatcher->onEvent("EngineConcurrency_post", ime::Callback<std::thread::id>([&](std::thread::id engineThread) {
+        dispatchedCount++;
+        if (engineThread != std::this_thread::get_id())
+            misroutedCount++;
+    }));
+
+    std::vector<std::thread> threads;
+    for (auto i = 0u; i < engineCount; ++i) {
+        threads.emplace_back([i] {
+            ime::PrefContainer settings;
+            settings.addPref(ime::Preference("HEADLESS", ime::PrefType::Bool, true));
+
+            ime::Engine engine("Engine " + std::to_string(i), settings);
+            engine.setFixedDeltaTime(ime::milliseconds(16));
+            engine.initialize();
+            engine.pushScene(std::make_unique<PostingScene>(100));
+            engine.run();
+        });
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+
+    dispatcher->removeEventListener("EngineConcurrency_post", listenerId);
+
+    CHECK(dispatchedCount.load() > 0);
+    CHECK_EQ(misroutedCount.load(), 0);
+}
+
+#ifdef IME_ENABLE_EVENT_STATS
+TEST_CASE("Each engine collects the event statistics of its own threads")
+{
+    const unsigned int engineCount = 4;
+    std::vector<ime::Uint64> ownEmitCounts(engineCount, 0);
+    std::vector<int> foreignEventCounts(engineCount, 0);
+    std::vector<std::thread> threads;
+
+    for (auto i = 0u; i < engineCount; ++i) {
+        threads.emplace_back([i, engineCount, &ownEmitCounts, &foreignEventCounts] {
+            ime::PrefContainer settings;
+            settings.addPref(ime::Preference("HEADLESS", ime::PrefType::Bool, true));
+
+            ime::Engine engine("Engine " + std::to_string(i), settings);
+            engine.setFixedDeltaTime(ime::milliseconds(16));
+            engine.initialize();
+            engine.pushScene(std::make_unique<EmittingScene>("EngineConcurrency_stats" + std::to_string(i), 100));
+            engine.run();
+
+            // The statistics are those of the last frame of the engine
+            const ime::EventStats& stats = engine.getEventStats();
+            for (auto j = 0u; j < engineCount; ++j) {
+                const ime::EventStats::Entry* entry = stats.find("EngineConcurrency_stats" + std::to_string(j));
+                if (j == i)
+                    ownEmitCounts[i] = entry ? entry->emitCount : 0;
+                else if (entry)
+                    foreignEventCounts[i]++;
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+
+    for (auto i = 0u; i < engineCount; ++i) {
+        CHECK_EQ(ownEmitCounts[i], 1u);
+        CHECK_EQ(foreignEventCounts[i], 0);
+    }
+}
+#endif
@@ -0,0 +1,169 @@
+////////////////////////////////////////////////////////////////////////////////
+// IME - Infinite Motion Engine
+//
+// Copyright (c) 2020-2022 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "IME/core/event/EventBatch.h"
+#include <doctest.h>
+
+namespace {
+    ime::Event mouseMoved(int x, int y) {
+        ime::Event event;
+        event.type = ime::Event::MouseMoved;
+        event.mouseMove.x = x;
+        event.mouseMove.y = y;
+        return event;
+    }
+
+    ime::Event joystickMoved(unsigned int id, ime::input::Joystick::Axis axis, float position) {
+        ime::Event event;
+        event.type = ime::Event::JoystickMoved;
+        event.joystickMove.joystickId = id;
+        event.joystickMove.axis = axis;
+        event.joystickMove.position = position;
+        return event;
+    }
+
+    ime::Event keyPressed() {
+        ime::Event event;
+        event.type = ime::Event::KeyPressed;
+        return event;
+    }
+}
+
+TEST_CASE("ime::EventMask class")
+{
+    SUBCASE("Default constructed mask is empty")
+    {
+        ime::EventMask mask;
+        CHECK(mask.isEmpty());
+        CHECK_FALSE(mask.contains(ime::Event::Closed));
+        CHECK_FALSE(mask.contains(ime::Event::JoystickDisconnected));
+    }
+
+    SUBCASE("Initializer list constructor")
+    {
+        ime::EventMask mask{ime::Event::KeyPressed, ime::Event::MouseMoved};
+        CHECK(mask.contains(ime::Event::KeyPressed));
+        CHECK(mask.contains(ime::Event::MouseMoved));
+        CHECK_FALSE(mask.contains(ime::Event::KeyReleased));
+    }
+
+    SUBCASE("all() contains every event type")
+    {
+        ime::EventMask mask = ime::EventMask::all();
+        CHECK(mask.contains(ime::Event::Closed));
+        CHECK(mask.contains(ime::Event::JoystickDisconnected));
+        CHECK_FALSE(mask.contains(ime::Event::Unknown));
+    }
+
+    SUBCASE("add() and remove()")
+    {
+        ime::EventMask mask;
+        mask.add(ime::Event::Resized);
+        CHECK(mask.contains(ime::Event::Resized));
+        mask.remove(ime::Event::Resized);
+        CHECK(mask.isEmpty());
+    }
+
+    SUBCASE("Union and intersection")
+    {
+        CHECK(ime::EventMasks::Input.intersects(ime::EventMasks::Mouse));
+        CHECK_FALSE(ime::EventMasks::Keyboard.intersects(ime::EventMasks::Joystick));
+        CHECK_EQ(ime::EventMasks::Keyboard | ime::EventMasks::Mouse | ime::EventMasks::Joystick, ime::EventMasks::Input);
+        CHECK_FALSE(ime::EventMasks::Input.contains(ime::Event::Resized));
+    }
+}
+
+TEST_CASE("ime::EventBatch class")
+{
+    SUBCASE("Default constructed batch is empty")
+    {
+        ime::EventBatch batch;
+        CHECK(batch.isEmpty());
+        CHECK_EQ(batch.getCount(), 0u);
+        CHECK(batch.getTypes().isEmpty());
+    }
+
+    SUBCASE("push() appends events in order and records their types")
+    {
+        ime::EventBatch batch;
+        batch.push(keyPressed());
+        batch.push(mouseMoved(1, 2));
+
+        CHECK_EQ(batch.getCount(), 2u);
+        CHECK_EQ(batch.begin()->type, ime::Event::KeyPressed);
+        CHECK_EQ((batch.begin() + 1)->type, ime::Event::MouseMoved);
+        CHECK(batch.getTypes().contains(ime::Event::KeyPressed));
+        CHECK(batch.getTypes().contains(ime::Event::MouseMoved));
+        CHECK_FALSE(batch.getTypes().contains(ime::Event::Closed));
+    }
+
+    SUBCASE("clear() removes all events and types")
+    {
+        ime::EventBatch batch;
+        batch.push(keyPressed());
+        batch.clear();
+
+        CHECK(batch.isEmpty());
+        CHECK(batch.getTypes().isEmpty());
+    }
+
+    SUBCASE("coalesce() keeps the last of consecutive mouse move events")
+    {
+        ime::EventBatch batch;
+        batch.push(mouseMoved(1, 1));
+        batch.push(mouseMoved(2, 2));
+        batch.push(mouseMoved(3, 3));
+
+        CHECK_EQ(batch.coalesce(), 2u);
+        REQUIRE_EQ(batch.getCount(), 1u);
+        CHECK_EQ(batch.begin()->mouseMove.x, 3);
+    }
+
+    SUBCASE("coalesce() does not merge mouse moves across other events")
+    {
+        ime::EventBatch batch;
+        batch.push(mouseMoved(1, 1));
+        batch.push(keyPressed());
+        batch.push(mouseMoved(2, 2));
+
+        CHECK_EQ(batch.coalesce(), 0u);
+        CHECK_EQ(batch.getCount(), 3u);
+    }
+
+    SUBCASE("coalesce() merges joystick moves of the same joystick axis only")
+    {
+        ime::EventBatch batch;
+        using Axis = ime::input::Joystick::Axis;
+        batch.push(joystickMoved(0, Axis::X, 10.0f));
+        batch.push(joystickMoved(0, Axis::X, 20.0f));
+        batch.push(joystickMoved(0, Axis::Y, 30.0f));
+        batch.push(joystickMoved(1, Axis::Y, 40.0f));
+
+        CHECK_EQ(batch.coalesce(), 1u);
+        REQUIRE_EQ(batch.getCount(), 3u);
+        CHECK_EQ(batch.begin()->joystickMove.position, 20.0f);
+        CHECK_EQ((batch.begin() + 1)->joystickMove.position, 30.0f);
+        CHECK_EQ((batch.begin() + 2)->joystickMove.position, 40.0f);
+    }
+}
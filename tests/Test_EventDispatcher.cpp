@@ -0,0 +1,141 @@
+////////////////////////////////////////////////////////////////////////////////
+// IME - Infinite Motion Engine
+//
+// Copyright (c) 2020-2022 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "IME/core/event/EventDispatcher.h"
+#include <doctest.h>
+#include <thread>
+#include <vector>
+
+TEST_CASE("ime::EventDispatcher class")
+{
+    SUBCASE("dispatchEvent() invokes event listeners immediately")
+    {
+        auto dispatcher = ime::EventDispatcher::instance();
+        int value = 0;
+        int id = dispatcher->onEvent("dispatchTest", ime::Callback<int>([&value](int num) { value = num; }));
+
+        dispatcher->dispatchEvent("dispatchTest", 5);
+
+        CHECK_EQ(value, 5);
+        dispatcher->removeEventListener("dispatchTest", id);
+    }
+
+    SUBCASE("Queued events")
+    {
+        SUBCASE("A posted event is only dispatched by dispatchQueuedEvents()")
+        {
+            auto dispatcher = ime::EventDispatcher::instance();
+            int value = 0;
+            int id = dispatcher->onEvent("postTest", ime::Callback<int>([&value](int num) { value += num; }));
+
+            dispatcher->post("postTest", 5);
+            CHECK_EQ(value, 0);
+
+            CHECK_EQ(dispatcher->dispatchQueuedEvents(), 1);
+            CHECK_EQ(value, 5);
+            CHECK_EQ(dispatcher->dispatchQueuedEvents(), 0);
+            dispatcher->removeEventListener("postTest", id);
+        }
+
+        SUBCASE("Posted events are dispatched in the order in which they were posted")
+        {
+            auto dispatcher = ime::EventDispatcher::instance();
+            std::vector<int> values;
+            int id = dispatcher->onEvent("orderTest", ime::Callback<int>([&values](int num) { values.push_back(num); }));
+
+            for (int i = 0; i < 5; ++i)
+                dispatcher->post("orderTest", i);
+
+            dispatcher->dispatchQueuedEvents();
+
+            REQUIRE_EQ(values.size(), 5);
+            for (int i = 0; i < 5; ++i)
+                CHECK_EQ(values[i], i);
+
+            dispatcher->removeEventListener("orderTest", id);
+        }
+
+        SUBCASE("A coalesced event replaces the arguments of a queued event with the same name")
+        {
+            auto dispatcher = ime::EventDispatcher::instance();
+            std::vector<int> values;
+            int id = dispatcher->onEvent("coalesceTest", ime::Callback<int>([&values](int num) { values.push_back(num); }));
+
+            dispatcher->postCoalesced("coalesceTest", 1);
+            dispatcher->postCoalesced("coalesceTest", 2);
+            dispatcher->post("coalesceTest", 3);
+            dispatcher->postCoalesced("coalesceTest", 4);
+
+            CHECK_EQ(dispatcher->dispatchQueuedEvents(), 2);
+            REQUIRE_EQ(values.size(), 2);
+            CHECK_EQ(values[0], 4);
+            CHECK_EQ(values[1], 3);
+
+            dispatcher->removeEventListener("coalesceTest", id);
+        }
+
+        SUBCASE("Events that exceed the budget remain queued")
+        {
+            auto dispatcher = ime::EventDispatcher::instance();
+            int count = 0;
+            int id = dispatcher->onEvent("budgetTest", ime::Callback<>([&count] { count++; }));
+
+            dispatcher->setQueuedEventBudget(2);
+            CHECK_EQ(dispatcher->getQueuedEventBudget(), 2);
+
+            for (int i = 0; i < 5; ++i)
+                dispatcher->post("budgetTest");
+
+            CHECK_EQ(dispatcher->dispatchQueuedEvents(), 2);
+            CHECK_EQ(dispatcher->dispatchQueuedEvents(), 2);
+            CHECK_EQ(dispatcher->dispatchQueuedEvents(), 1);
+            CHECK_EQ(count, 5);
+
+            dispatcher->setQueuedEventBudget(0);
+            dispatcher->removeEventListener("budgetTest", id);
+        }
+
+        SUBCASE("Events can be posted from multiple threads")
+        {
+            auto dispatcher = ime::EventDispatcher::instance();
+            int sum = 0;
+            int id = dispatcher->onEvent("threadTest", ime::Callback<int>([&sum](int num) { sum += num; }));
+
+            std::vector<std::thread> threads;
+            for (int t = 0; t < 4; ++t) {
+                threads.emplace_back([&dispatcher] {
+                    for (int i = 0; i < 1000; ++i)
+                        dispatcher->post("threadTest", 1);
+                });
+            }
+
+            for (auto& thread : threads)
+                thread.join();
+
+            CHECK_EQ(dispatcher->dispatchQueuedEvents(), 4000);
+            CHECK_EQ(sum, 4000);
+            dispatcher->removeEventListener("threadTest", id);
+        }
+    }
+}
@@ -25,6 +25,10 @@
 #include "IME/core/event/EventEmitter.h"
 #include <doctest.h>
 #include <algorithm>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
 
 TEST_CASE("ime::EventEmitter class")
 {
@@ -36,6 +40,35 @@ TEST_CASE("ime::EventEmitter class")
 
             CHECK(eventEmitter.isActive());
             CHECK_EQ(eventEmitter.getEventsCount(), 0);
+            CHECK_EQ(eventEmitter.getThreadingPolicy(), ime::EventEmitter::ThreadingPolicy::MultiThreaded);
+        }
+
+        SUBCASE("Threading policy constructor")
+        {
+            ime::EventEmitter eventEmitter(ime::EventEmitter::ThreadingPolicy::SingleThreaded);
+            int count = 0;
+            eventEmitter.on("event", ime::Callback<>([&count] { count++; }));
+            eventEmitter.emit("event");
+
+            CHECK_EQ(eventEmitter.getThreadingPolicy(), ime::EventEmitter::ThreadingPolicy::SingleThreaded);
+            CHECK_EQ(count, 1);
+        }
+
+        SUBCASE("Copy constructor copies the threading policy")
+        {
+            ime::EventEmitter eventEmitter(ime::EventEmitter::ThreadingPolicy::SingleThreaded);
+            ime::EventEmitter copy(eventEmitter);
+
+            CHECK_EQ(copy.getThreadingPolicy(), ime::EventEmitter::ThreadingPolicy::SingleThreaded);
+        }
+
+        SUBCASE("Assignment retains the threading policy")
+        {
+            ime::EventEmitter eventEmitter(ime::EventEmitter::ThreadingPolicy::SingleThreaded);
+            ime::EventEmitter other;
+            eventEmitter = other;
+
+            CHECK_EQ(eventEmitter.getThreadingPolicy(), ime::EventEmitter::ThreadingPolicy::SingleThreaded);
         }
     }
 
@@ -197,6 +230,41 @@ TEST_CASE("ime::EventEmitter class")
             eventEmitter.clear();
             CHECK_EQ(eventEmitter.getEventsCount(), 0);
         }
+
+        SUBCASE("Event listeners can be removed and suspended by id after the emitter is copied or moved")
+        {
+            ime::EventEmitter eventEmitter;
+            int id1 = eventEmitter.addEventListener("event1", ime::Callback<>([] {}));
+            int id2 = eventEmitter.addEventListener("event2", ime::Callback<int>([](int) {}));
+
+            ime::EventEmitter copy(eventEmitter);
+            CHECK(copy.suspendEventListener(id1, true));
+            CHECK(copy.isEventListenerSuspended(id1));
+            CHECK_FALSE(eventEmitter.isEventListenerSuspended(id1));
+            CHECK(copy.removeEventListener(id2));
+            CHECK_FALSE(copy.hasEventListener("event2", id2));
+            CHECK(eventEmitter.hasEventListener("event2", id2));
+
+            ime::EventEmitter moved(std::move(eventEmitter));
+            CHECK(moved.removeEventListener(id1));
+            CHECK(moved.removeEventListener(id2));
+            CHECK_FALSE(moved.removeEventListener(id2));
+        }
+
+        SUBCASE("A removed event listener can no longer be found by id")
+        {
+            ime::EventEmitter eventEmitter;
+            int id = eventEmitter.addEventListener("event", ime::Callback<>([] {}));
+            int onceId = eventEmitter.addOnceEventListener("event", ime::Callback<>([] {}));
+
+            eventEmitter.emit("event");
+            CHECK_FALSE(eventEmitter.suspendEventListener(onceId, true));
+            CHECK_FALSE(eventEmitter.removeEventListener(onceId));
+
+            eventEmitter.removeAllEventListeners("event");
+            CHECK_FALSE(eventEmitter.suspendEventListener(id, true));
+            CHECK_FALSE(eventEmitter.isEventListenerSuspended(id));
+        }
     }
 
     SUBCASE("Invoking event listeners")
@@ -305,6 +373,237 @@ TEST_CASE("ime::EventEmitter class")
                 CHECK_EQ(num2, -1);
             }
 
+            SUBCASE("A reference event listener is invoked when the argument type is explicitly a reference")
+            {
+                ime::EventEmitter eventEmitter;
+
+                eventEmitter.addEventListener("event", ime::Callback<int&>([](int& num) {
+                    num = 20;
+                }));
+
+                int num = 10;
+                eventEmitter.emit<int&>("event", num);
+
+                CHECK_EQ(num, 20);
+            }
+
+            SUBCASE("String literal arguments are received as pointers")
+            {
+                ime::EventEmitter eventEmitter;
+
+                std::string received;
+                eventEmitter.addEventListener("event", ime::Callback<const char*>([&received](const char* text) {
+                    received = text;
+                }));
+
+                eventEmitter.emit("event", "text");
+
+                CHECK_EQ(received, "text");
+            }
+
+            SUBCASE("Event listeners added during an emission are invoked by the next emission")
+            {
+                ime::EventEmitter eventEmitter;
+
+                int invokeCount = 0;
+                int addedCount = 0;
+                eventEmitter.addEventListener("event", ime::Callback<>([&] {
+                    invokeCount++;
+                    for (int i = 0; i < 32; ++i)
+                        eventEmitter.addOnceEventListener("event", ime::Callback<>([&addedCount] { addedCount++; }));
+
+                    CHECK_EQ(eventEmitter.getEventListenerCount("event"), 1 + 32 * invokeCount);
+                }));
+
+                eventEmitter.emit("event");
+                CHECK_EQ(invokeCount, 1);
+                CHECK_EQ(addedCount, 0);
+                CHECK_EQ(eventEmitter.getEventListenerCount("event"), 33);
+
+                eventEmitter.emit("event");
+                CHECK_EQ(invokeCount, 2);
+                CHECK_EQ(addedCount, 32);
+                CHECK_EQ(eventEmitter.getEventListenerCount("event"), 33);
+            }
+
+            SUBCASE("An event listener can remove itself during an emission")
+            {
+                ime::EventEmitter eventEmitter;
+
+                int id = -1;
+                int invokeCount = 0;
+                bool isOtherInvoked = false;
+                id = eventEmitter.addEventListener("event", ime::Callback<>([&eventEmitter, &id, &invokeCount] {
+                    CHECK(eventEmitter.removeEventListener("event", id));
+                    CHECK_FALSE(eventEmitter.hasEventListener("event", id));
+                    invokeCount++;
+                }));
+
+                eventEmitter.addEventListener("event", ime::Callback<>([&isOtherInvoked] {
+                    isOtherInvoked = true;
+                }));
+
+                eventEmitter.emit("event");
+                eventEmitter.emit("event");
+
+                CHECK_EQ(invokeCount, 1);
+                CHECK(isOtherInvoked);
+                CHECK_EQ(eventEmitter.getEventListenerCount("event"), 1);
+            }
+
+            SUBCASE("An event listener removed during an emission is not invoked")
+            {
+                ime::EventEmitter eventEmitter;
+
+                int secondId = -1;
+                bool isSecondInvoked = false;
+                eventEmitter.addEventListener("event", ime::Callback<>([&eventEmitter, &secondId] {
+                    eventEmitter.removeEventListener(secondId);
+                }));
+
+                secondId = eventEmitter.addEventListener("event", ime::Callback<>([&isSecondInvoked] {
+                    isSecondInvoked = true;
+                }));
+
+                eventEmitter.emit("event");
+
+                CHECK_FALSE(isSecondInvoked);
+                CHECK_EQ(eventEmitter.getEventListenerCount("event"), 1);
+            }
+
+            SUBCASE("A 'once' event listener is not invoked again by a nested emission")
+            {
+                ime::EventEmitter eventEmitter;
+
+                int invokeCount = 0;
+                eventEmitter.addOnceEventListener("event", ime::Callback<>([&eventEmitter, &invokeCount] {
+                    invokeCount++;
+                    eventEmitter.emit("event");
+                }));
+
+                eventEmitter.emit("event");
+
+                CHECK_EQ(invokeCount, 1);
+                CHECK_EQ(eventEmitter.getEventListenerCount("event"), 0);
+            }
+
+            SUBCASE("Clearing the emitter during an emission removes all event listeners")
+            {
+                ime::EventEmitter eventEmitter;
+
+                int invokeCount = 0;
+                eventEmitter.addEventListener("event", ime::Callback<>([&eventEmitter, &invokeCount] {
+                    invokeCount++;
+                    eventEmitter.clear();
+                }));
+
+                eventEmitter.addEventListener("event", ime::Callback<>([&invokeCount] {
+                    invokeCount++;
+                }));
+
+                eventEmitter.emit("event");
+                eventEmitter.emit("event");
+
+                CHECK_EQ(invokeCount, 1);
+                CHECK_EQ(eventEmitter.getEventListenerCount("event"), 0);
+            }
+
+            SUBCASE("An event emitter copied during an emission gets the event listeners of the emitter after the emission")
+            {
+                ime::EventEmitter eventEmitter;
+                std::unique_ptr<ime::EventEmitter> copy;
+
+                int removedId = -1, addedId = -1;
+                eventEmitter.addOnceEventListener("event", ime::Callback<>([&] {
+                    eventEmitter.removeEventListener(removedId);
+                    addedId = eventEmitter.addEventListener("event", ime::Callback<>([] {}));
+                    copy = std::make_unique<ime::EventEmitter>(eventEmitter);
+                }));
+
+                removedId = eventEmitter.addEventListener("event", ime::Callback<>([] {}));
+
+                eventEmitter.emit("event");
+
+                REQUIRE(copy);
+                CHECK_EQ(copy->getEventListenerCount("event"), 1);
+                CHECK_FALSE(copy->hasEventListener("event", removedId));
+                CHECK(copy->hasEventListener("event", addedId));
+                CHECK(copy->removeEventListener(addedId));
+            }
+
+            SUBCASE("An event emitter assigned from during an emission gets the event listeners of the emitter after the emission")
+            {
+                ime::EventEmitter eventEmitter;
+                ime::EventEmitter copy;
+                copy.addEventListener("other", ime::Callback<>([] {}));
+
+                int removedId = -1;
+                eventEmitter.addEventListener("event", ime::Callback<>([&] {
+                    eventEmitter.removeEventListener(removedId);
+                    copy = eventEmitter;
+                }));
+
+                removedId = eventEmitter.addEventListener("event", ime::Callback<>([] {}));
+
+                eventEmitter.emit("event");
+
+                CHECK_EQ(copy.getEventListenerCount("event"), 1);
+                CHECK_EQ(copy.getEventListenerCount("other"), 0);
+                CHECK_FALSE(copy.hasEventListener("event", removedId));
+                CHECK_EQ(eventEmitter.getEventListenerCount("event"), 1);
+            }
+
+            SUBCASE("An event emitter moved from during an emission keeps emitting safely")
+            {
+                ime::EventEmitter eventEmitter;
+                ime::EventEmitter target;
+                target.addEventListener("other", ime::Callback<>([] {}));
+
+                int invokeCount = 0;
+                eventEmitter.addEventListener("event", ime::Callback<>([&] {
+                    invokeCount++;
+                    target = std::move(eventEmitter);
+                }));
+
+                eventEmitter.addEventListener("event", ime::Callback<>([&invokeCount] {
+                    invokeCount++;
+                }));
+
+                eventEmitter.emit("event");
+                CHECK_EQ(invokeCount, 2);
+                CHECK_EQ(target.getEventListenerCount("event"), 2);
+                CHECK_EQ(target.getEventListenerCount("other"), 0);
+                CHECK_EQ(eventEmitter.getEventListenerCount("event"), 0);
+
+                // The moved from emitter remains usable
+                eventEmitter.addEventListener("event", ime::Callback<>([&invokeCount] {
+                    invokeCount += 10;
+                }));
+
+                eventEmitter.emit("event");
+                CHECK_EQ(invokeCount, 12);
+            }
+
+            SUBCASE("A copied event emitter invokes copies of the event listeners")
+            {
+                int sum = 0;
+                ime::EventEmitter copy;
+
+                {
+                    ime::EventEmitter eventEmitter;
+                    eventEmitter.addEventListener("event", ime::Callback<int>([&sum](int num) {
+                        sum += num;
+                    }));
+
+                    copy = eventEmitter;
+                    eventEmitter.emit("event", 1);
+                }
+
+                copy.emit("event", 2);
+
+                CHECK_EQ(sum, 3);
+            }
+
             SUBCASE("A 'once' event listener is invoked only once")
             {
                 ime::EventEmitter eventEmitter;
@@ -374,4 +673,63 @@ TEST_CASE("ime::EventEmitter class")
             }
         }
     }
+
+    SUBCASE("Listener storage")
+    {
+        SUBCASE("An event emitter without event listeners ignores all operations")
+        {
+            ime::EventEmitter eventEmitter;
+            eventEmitter.emit("event", 10);
+            eventEmitter.clear();
+
+            CHECK_EQ(eventEmitter.getEventsCount(), 0);
+            CHECK_EQ(eventEmitter.getEventListenerCount("event"), 0);
+            CHECK(eventEmitter.getEvents().empty());
+            CHECK_FALSE(eventEmitter.hasEvent("event"));
+            CHECK_FALSE(eventEmitter.removeEventListener(1));
+            CHECK_FALSE(eventEmitter.removeAllEventListeners("event"));
+            CHECK_FALSE(eventEmitter.suspendEventListener(1, true));
+        }
+
+        SUBCASE("Assigning an event emitter without event listeners removes all event listeners")
+        {
+            ime::EventEmitter eventEmitter, empty;
+            eventEmitter.on("event", ime::Callback<>([] {}));
+
+            eventEmitter = empty;
+            CHECK_EQ(eventEmitter.getEventListenerCount("event"), 0);
+
+            eventEmitter.on("event", ime::Callback<>([] {}));
+            eventEmitter = ime::EventEmitter();
+            CHECK_EQ(eventEmitter.getEventListenerCount("event"), 0);
+        }
+
+        SUBCASE("Moving an event emitter into one without event listeners moves the event listeners")
+        {
+            ime::EventEmitter eventEmitter, other;
+            int id = other.on("event", ime::Callback<>([] {}));
+
+            eventEmitter = std::move(other);
+            CHECK(eventEmitter.hasEventListener("event", id));
+            CHECK(eventEmitter.removeEventListener(id));
+        }
+
+        SUBCASE("Event listeners added by multiple threads to a new event emitter are all kept")
+        {
+            ime::EventEmitter eventEmitter;
+            std::vector<std::thread> threads;
+
+            for (int i = 0; i < 4; i++) {
+                threads.emplace_back([&eventEmitter] {
+                    for (int j = 0; j < 100; j++)
+                        eventEmitter.on("event", ime::Callback<>([] {}));
+                });
+            }
+
+            for (auto& thread : threads)
+                thread.join();
+
+            CHECK_EQ(eventEmitter.getEventListenerCount("event"), 400);
+        }
+    }
 }
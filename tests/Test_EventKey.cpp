@@ -0,0 +1,84 @@
+////////////////////////////////////////////////////////////////////////////////
+// IME - Infinite Motion Engine
+//
+// Copyright (c) 2020-2022 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "IME/core/event/EventKey.h"
+#include "IME/core/event/EventEmitter.h"
+#include <doctest.h>
+#include <string>
+
+TEST_CASE("ime::EventKey class")
+{
+    SUBCASE("Hash is computed at compile time")
+    {
+        constexpr ime::EventKey key{"click"};
+        static_assert(key.getHash() == ime::EventKey::computeHash("click"), "Hash must be a constant expression");
+
+        CHECK_EQ(key.getName(), "click");
+        CHECK_EQ(key.getHash(), ime::EventKey::computeHash("click"));
+    }
+
+    SUBCASE("Keys with the same name are equal")
+    {
+        std::string name = "click";
+        ime::EventKey literalKey{"click"};
+        ime::EventKey stringKey{name};
+
+        CHECK(literalKey == stringKey);
+        CHECK_FALSE(literalKey != stringKey);
+        CHECK(literalKey != ime::EventKey("hover"));
+    }
+
+    SUBCASE("Keys are interchangeable with event names")
+    {
+        constexpr ime::EventKey clickEvent{"click"};
+        ime::EventEmitter emitter;
+        int clickCount = 0;
+
+        emitter.on("click", ime::Callback<>([&clickCount] { clickCount++; }));
+        emitter.emit(clickEvent);
+        emitter.emit(std::string("click"));
+        emitter.emit("click");
+
+        CHECK_EQ(clickCount, 3);
+        CHECK(emitter.hasEvent(clickEvent));
+        CHECK_EQ(emitter.getEventListenerCount(std::string("click")), 1);
+        CHECK_EQ(emitter.getEvents().size(), 1);
+        CHECK_EQ(emitter.getEvents().front(), "click");
+    }
+
+    SUBCASE("Emitter does not keep a reference to the key name")
+    {
+        ime::EventEmitter emitter;
+        int count = 0;
+
+        {
+            std::string name = "temporary";
+            emitter.on(name, ime::Callback<>([&count] { count++; }));
+        }
+
+        emitter.emit("temporary");
+        CHECK_EQ(count, 1);
+        CHECK_EQ(emitter.getEvents().front(), "temporary");
+    }
+}
@@ -0,0 +1,143 @@
+////////////////////////////////////////////////////////////////////////////////
+// IME - Infinite Motion Engine
+//
+// Copyright (c) 2020-2022 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "IME/core/event/EventStats.h"
+#include "IME/core/event/EventEmitter.h"
+#include <doctest.h>
+#include <thread>
+#include <vector>
+
+TEST_CASE("ime::EventStats struct")
+{
+#ifdef IME_ENABLE_EVENT_STATS
+    SUBCASE("Emits are counted per event")
+    {
+        ime::priv::collectEventStats();
+
+        ime::EventEmitter emitter;
+        emitter.on("stats_click", ime::Callback<>([] {}));
+        emitter.on("stats_click", ime::Callback<>([] {}));
+        emitter.addOnceEventListener("stats_click", ime::Callback<>([] {}));
+
+        emitter.emit("stats_click");
+        emitter.emit("stats_click");
+        emitter.emit("stats_hover");
+
+        ime::EventStats stats = ime::priv::collectEventStats();
+
+        const ime::EventStats::Entry* click = stats.find("stats_click");
+        REQUIRE(click);
+        CHECK_EQ(click->emitCount, 2u);
+        CHECK_EQ(click->listenersInvoked, 5u);
+        CHECK_EQ(click->onceListenersRemoved, 1u);
+
+        const ime::EventStats::Entry* hover = stats.find("stats_hover");
+        REQUIRE(hover);
+        CHECK_EQ(hover->emitCount, 1u);
+        CHECK_EQ(hover->listenersInvoked, 0u);
+    }
+
+    SUBCASE("Emits of events without listeners are counted")
+    {
+        ime::priv::collectEventStats();
+
+        ime::EventEmitter emitter;
+        emitter.emit("stats_unheard");
+        emitter.emit("stats_unheard");
+
+        ime::EventStats stats = ime::priv::collectEventStats();
+        const ime::EventStats::Entry* unheard = stats.find("stats_unheard");
+        REQUIRE(unheard);
+        CHECK_EQ(unheard->emitCount, 2u);
+        CHECK_EQ(unheard->listenersInvoked, 0u);
+    }
+
+    SUBCASE("Emits of multiple threads are collected together")
+    {
+        ime::priv::collectEventStats();
+
+        std::vector<std::thread> threads;
+        for (int i = 0; i < 4; ++i) {
+            threads.emplace_back([] {
+                ime::EventEmitter emitter;
+                emitter.on("stats_thread", ime::Callback<>([] {}));
+
+                for (int j = 0; j < 10; ++j)
+                    emitter.emit("stats_thread");
+            });
+        }
+
+        for (auto& thread : threads)
+            thread.join();
+
+        ime::EventStats stats = ime::priv::collectEventStats();
+        const ime::EventStats::Entry* entry = stats.find("stats_thread");
+        REQUIRE(entry);
+        CHECK_EQ(entry->emitCount, 40u);
+        CHECK_EQ(entry->listenersInvoked, 40u);
+    }
+
+    SUBCASE("Collecting the statistics starts a new frame")
+    {
+        ime::EventEmitter emitter;
+        emitter.emit("stats_frame");
+        ime::priv::collectEventStats();
+
+        ime::EventStats stats = ime::priv::collectEventStats();
+        CHECK_FALSE(stats.find("stats_frame"));
+        CHECK_EQ(stats.dispatchTime, ime::Time::Zero);
+    }
+
+    SUBCASE("Nested emits are only counted once in the total dispatch time")
+    {
+        ime::priv::collectEventStats();
+
+        ime::EventEmitter emitter;
+        emitter.on("stats_inner", ime::Callback<>([] {}));
+        emitter.on("stats_outer", ime::Callback<>([&emitter] {
+            emitter.emit("stats_inner");
+        }));
+
+        emitter.emit("stats_outer");
+
+        ime::EventStats stats = ime::priv::collectEventStats();
+        REQUIRE(stats.find("stats_outer"));
+        REQUIRE(stats.find("stats_inner"));
+        CHECK_EQ(stats.emitCount, 2u);
+        CHECK_EQ(stats.dispatchTime, stats.find("stats_outer")->dispatchTime);
+    }
+#else
+    SUBCASE("Nothing is collected when statistics are compiled out")
+    {
+        ime::EventEmitter emitter;
+        emitter.on("stats_click", ime::Callback<>([] {}));
+        emitter.emit("stats_click");
+
+        ime::EventStats stats = ime::priv::collectEventStats();
+        CHECK_FALSE(ime::EventStats::isEnabled());
+        CHECK(stats.events.empty());
+        CHECK_EQ(stats.emitCount, 0u);
+    }
+#endif
+}
@@ -0,0 +1,115 @@
+////////////////////////////////////////////////////////////////////////////////
+// IME - Infinite Motion Engine
+//
+// Copyright (c) 2020-2022 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "IME/core/engine/FramePacer.h"
+#include <doctest.h>
+#include <chrono>
+
+TEST_CASE("ime::FramePacer class")
+{
+    SUBCASE("Constructors")
+    {
+        SUBCASE("Default constructor")
+        {
+            ime::FramePacer pacer;
+
+            CHECK_FALSE(pacer.isLimiterEnabled());
+            CHECK_FALSE(pacer.isSmoothingEnabled());
+            CHECK_EQ(pacer.getFrameRateLimit(), 60);
+            CHECK_EQ(pacer.getSpinThreshold(), ime::milliseconds(2));
+            CHECK_EQ(pacer.getSmoothingWindow(), 5);
+        }
+    }
+
+    SUBCASE("Smoothing")
+    {
+        SUBCASE("The delta time is unchanged when smoothing is disabled")
+        {
+            ime::FramePacer pacer;
+            CHECK_EQ(pacer.smooth(ime::milliseconds(16)), ime::milliseconds(16));
+            CHECK_EQ(pacer.smooth(ime::milliseconds(40)), ime::milliseconds(40));
+        }
+
+        SUBCASE("A single spike is removed by the rolling median")
+        {
+            ime::FramePacer pacer;
+            pacer.setSmoothingEnabled(true);
+
+            pacer.smooth(ime::milliseconds(16));
+            pacer.smooth(ime::milliseconds(17));
+            pacer.smooth(ime::milliseconds(16));
+            pacer.smooth(ime::milliseconds(16));
+            CHECK_EQ(pacer.smooth(ime::milliseconds(50)), ime::milliseconds(16));
+        }
+
+        SUBCASE("Old samples leave the smoothing window")
+        {
+            ime::FramePacer pacer;
+            pacer.setSmoothingEnabled(true);
+            pacer.setSmoothingWindow(3);
+
+            pacer.smooth(ime::milliseconds(10));
+            pacer.smooth(ime::milliseconds(10));
+            pacer.smooth(ime::milliseconds(10));
+            pacer.smooth(ime::milliseconds(30));
+            CHECK_EQ(pacer.smooth(ime::milliseconds(30)), ime::milliseconds(30));
+        }
+
+        SUBCASE("The smoothing window is at least one frame")
+        {
+            ime::FramePacer pacer;
+            pacer.setSmoothingWindow(0);
+            CHECK_EQ(pacer.getSmoothingWindow(), 1);
+        }
+    }
+
+    SUBCASE("Limiting")
+    {
+        SUBCASE("waitForNextFrame() does not block when the limiter is disabled")
+        {
+            ime::FramePacer pacer;
+            pacer.setFrameRateLimit(1);
+
+            auto start = std::chrono::steady_clock::now();
+            pacer.waitForNextFrame();
+            pacer.waitForNextFrame();
+            CHECK_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(500));
+        }
+
+        SUBCASE("waitForNextFrame() spaces frames by the frame rate limit")
+        {
+            ime::FramePacer pacer;
+            pacer.setLimiterEnabled(true);
+            pacer.setFrameRateLimit(100);
+
+            pacer.waitForNextFrame();
+            auto start = std::chrono::steady_clock::now();
+
+            for (int i = 0; i < 5; ++i)
+                pacer.waitForNextFrame();
+
+            CHECK_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(45));
+        }
+    }
+}
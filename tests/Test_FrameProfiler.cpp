@@ -0,0 +1,148 @@
+////////////////////////////////////////////////////////////////////////////////
+// IME - Infinite Motion Engine
+//
+// Copyright (c) 2020-2022 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "IME/core/engine/FrameProfiler.h"
+#include <doctest.h>
+#include <thread>
+
+TEST_CASE("ime::FrameProfiler class")
+{
+    SUBCASE("Constructors")
+    {
+        SUBCASE("Default constructor")
+        {
+            ime::FrameProfiler profiler;
+
+            CHECK(profiler.isEnabled());
+            CHECK_EQ(profiler.getCapacity(), 300);
+            CHECK_EQ(profiler.getRecordCount(), 0);
+            CHECK_EQ(profiler.computeStats().frameCount, 0);
+        }
+    }
+
+    SUBCASE("Recording frames")
+    {
+        SUBCASE("Each complete frame is recorded")
+        {
+            ime::FrameProfiler profiler;
+
+            for (int i = 0; i < 5; ++i) {
+                profiler.beginFrame();
+                profiler.endPhase(ime::FramePhase::Update);
+                profiler.setFixedUpdateCount(static_cast<unsigned int>(i));
+                profiler.endFrame();
+            }
+
+            CHECK_EQ(profiler.getRecordCount(), 5);
+            CHECK_EQ(profiler.getLastFrame().fixedUpdates, 4);
+
+            ime::FrameStats stats = profiler.computeStats();
+            CHECK_EQ(stats.frameCount, 5);
+            CHECK_EQ(stats.maxFixedUpdates, 4);
+            CHECK_EQ(stats.averageFixedUpdates, 2.0f);
+        }
+
+        SUBCASE("Only the most recent frames are kept")
+        {
+            ime::FrameProfiler profiler(3);
+
+            for (unsigned int i = 0; i < 10; ++i) {
+                profiler.beginFrame();
+                profiler.setFixedUpdateCount(i);
+                profiler.endFrame();
+            }
+
+            CHECK_EQ(profiler.getRecordCount(), 3);
+            CHECK_EQ(profiler.getLastFrame().fixedUpdates, 9);
+            CHECK_EQ(profiler.computeStats().maxFixedUpdates, 9);
+
+            SUBCASE("Reducing the capacity keeps the newest frames")
+            {
+                profiler.setCapacity(1);
+                CHECK_EQ(profiler.getRecordCount(), 1);
+                CHECK_EQ(profiler.getLastFrame().fixedUpdates, 9);
+            }
+        }
+
+        SUBCASE("A disabled profiler does not record frames")
+        {
+            ime::FrameProfiler profiler;
+            profiler.setEnabled(false);
+            profiler.beginFrame();
+            profiler.endFrame();
+
+            CHECK_FALSE(profiler.isEnabled());
+            CHECK_EQ(profiler.getRecordCount(), 0);
+        }
+
+        SUBCASE("Time measured elsewhere and paused time")
+        {
+            ime::FrameProfiler profiler;
+            profiler.beginFrame();
+            profiler.addPhaseTime(ime::FramePhase::Update, ime::milliseconds(5));
+            profiler.addPhaseTime(ime::FramePhase::Update, ime::milliseconds(2));
+            profiler.pause();
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            profiler.resume();
+            profiler.endPhase(ime::FramePhase::Render);
+            profiler.endFrame();
+
+            const auto& frame = profiler.getLastFrame();
+            CHECK_EQ(frame.phases[static_cast<std::size_t>(ime::FramePhase::Update)], ime::milliseconds(7));
+            CHECK(frame.phases[static_cast<std::size_t>(ime::FramePhase::Render)] < ime::milliseconds(20));
+            CHECK(frame.frameTime >= ime::milliseconds(20));
+        }
+
+        SUBCASE("clear()")
+        {
+            ime::FrameProfiler profiler;
+            profiler.beginFrame();
+            profiler.endFrame();
+
+            REQUIRE_EQ(profiler.getRecordCount(), 1);
+            profiler.clear();
+            CHECK_EQ(profiler.getRecordCount(), 0);
+        }
+    }
+
+    SUBCASE("Statistics")
+    {
+        ime::FrameProfiler profiler;
+
+        for (int i = 0; i < 100; ++i) {
+            profiler.beginFrame();
+            profiler.endPhase(ime::FramePhase::Render);
+            profiler.endFrame();
+        }
+
+        ime::FrameStats stats = profiler.computeStats();
+        const ime::PhaseStats& render = stats.getPhase(ime::FramePhase::Render);
+
+        CHECK_LE(render.min, render.average);
+        CHECK_LE(render.average, render.max);
+        CHECK_LE(render.p95, render.p99);
+        CHECK_LE(render.p99, render.max);
+        CHECK_EQ(stats.getPhase(ime::FramePhase::Display).max, ime::Time::Zero);
+    }
+}
@@ -0,0 +1,136 @@
+////////////////////////////////////////////////////////////////////////////////
+// IME - Infinite Motion Engine
+//
+// Copyright (c) 2020-2022 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "IME/core/object/GameObject.h"
+#include "IME/core/object/GameObjectPool.h"
+#include "IME/core/scene/Scene.h"
+#include <doctest.h>
+
+namespace {
+    class GameObjectTestScene : public ime::Scene {};
+}
+
+TEST_CASE("ime::GameObject class")
+{
+    SUBCASE("Deferred transforms")
+    {
+        SUBCASE("A game object that is not stored by its scene is flushed right away")
+        {
+            GameObjectTestScene scene;
+            auto gameObject = ime::GameObject::create(scene);
+            gameObject->getTransform().setDeferredSyncEnabled(true);
+            gameObject->getTransform().setPosition(10.0f, 20.0f);
+
+            CHECK_FALSE(gameObject->getTransform().isDirty());
+            CHECK_EQ(gameObject->getSprite().getPosition(), ime::Vector2f(10.0f, 20.0f));
+        }
+
+        SUBCASE("A pooled game object is flushed right away")
+        {
+            GameObjectTestScene scene;
+            ime::GameObjectPool pool;
+            pool.addPrototype("bullet", ime::GameObject::create(scene));
+
+            ime::GameObject::Ptr instance = pool.acquire("bullet");
+            instance->getTransform().setDeferredSyncEnabled(true);
+            instance->getTransform().setPosition(10.0f, 20.0f);
+
+            CHECK_FALSE(instance->getTransform().isDirty());
+            CHECK_EQ(instance->getSprite().getPosition(), ime::Vector2f(10.0f, 20.0f));
+        }
+
+        SUBCASE("A game object stored by its scene is flushed when the scene syncs the transforms")
+        {
+            GameObjectTestScene scene;
+            auto gameObject = ime::GameObject::create(scene);
+            gameObject->getTransform().setDeferredSyncEnabled(true);
+            ime::GameObject* added = scene.getGameObjects().add(std::move(gameObject));
+
+            added->getTransform().setPosition(10.0f, 20.0f);
+            CHECK(added->getTransform().isDirty());
+            CHECK_EQ(added->getSprite().getPosition(), ime::Vector2f(0.0f, 0.0f));
+
+            scene.getGameObjects().syncTransforms();
+            CHECK_FALSE(added->getTransform().isDirty());
+            CHECK_EQ(added->getSprite().getPosition(), ime::Vector2f(10.0f, 20.0f));
+
+            // Once extracted, the scene no longer flushes the game object
+            ime::GameObject::Ptr extracted = scene.getGameObjects().extractById(added->getObjectId());
+            extracted->getTransform().setPosition(30.0f, 40.0f);
+            CHECK_FALSE(extracted->getTransform().isDirty());
+            CHECK_EQ(extracted->getSprite().getPosition(), ime::Vector2f(30.0f, 40.0f));
+        }
+    }
+
+    SUBCASE("Render interpolation")
+    {
+        SUBCASE("Only the interpolated game objects stored by the scene are visited")
+        {
+            GameObjectTestScene scene;
+            ime::GameObject* interpolated = scene.getGameObjects().add(ime::GameObject::create(scene));
+            scene.getGameObjects().add(ime::GameObject::create(scene));
+
+            auto addedInterpolated = ime::GameObject::create(scene);
+            addedInterpolated->getTransform().setInterpolationEnabled(true);
+            ime::GameObject* added = scene.getGameObjects().add(std::move(addedInterpolated));
+
+            interpolated->getTransform().setInterpolationEnabled(true);
+
+            auto countVisited = [&scene] {
+                int count = 0;
+                scene.getGameObjects().forEachInterpolated([&count](ime::GameObject*) { count++; });
+                return count;
+            };
+
+            CHECK_EQ(countVisited(), 2);
+
+            interpolated->getTransform().setInterpolationEnabled(false);
+            CHECK_EQ(countVisited(), 1);
+
+            ime::GameObject::Ptr extracted = scene.getGameObjects().extractById(added->getObjectId());
+            CHECK_EQ(countVisited(), 0);
+
+            extracted->getTransform().setInterpolationEnabled(false);
+            extracted->getTransform().setInterpolationEnabled(true);
+            CHECK_EQ(countVisited(), 0);
+        }
+
+        SUBCASE("Disabling interpolation renders the game object at its current state")
+        {
+            GameObjectTestScene scene;
+            ime::GameObject* gameObject = scene.getGameObjects().add(ime::GameObject::create(scene));
+            gameObject->getTransform().setInterpolationEnabled(true);
+            gameObject->getTransform().setPosition(10.0f, 20.0f);
+            gameObject->getTransform().setRotation(90.0f);
+
+            // Rendered halfway between two fixed updates
+            gameObject->getSprite().setPosition(5.0f, 10.0f);
+            gameObject->getSprite().setRotation(45.0f);
+
+            gameObject->getTransform().setInterpolationEnabled(false);
+            CHECK_EQ(gameObject->getSprite().getPosition(), ime::Vector2f(10.0f, 20.0f));
+            CHECK_EQ(gameObject->getSprite().getRotation(), 90.0f);
+        }
+    }
+}
@@ -0,0 +1,180 @@
+////////////////////////////////////////////////////////////////////////////////
+// IME - Infinite Motion Engine
+//
+// Copyright (c) 2020-2022 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "IME/core/object/GameObjectPool.h"
+#include "IME/core/scene/Scene.h"
+#include <doctest.h>
+
+namespace {
+    class PoolTestScene : public ime::Scene {};
+
+    ime::GameObject::Ptr createPrototype(ime::Scene& scene) {
+        auto prototype = ime::GameObject::create(scene);
+        prototype->setTag("bullet");
+        prototype->setState(2);
+        prototype->getTransform().setPosition(10.0f, 20.0f);
+        prototype->getTransform().setOrigin(1.0f, 1.0f);
+        return prototype;
+    }
+}
+
+TEST_CASE("ime::GameObjectPool class")
+{
+    SUBCASE("addPrototype() deactivates the prototype")
+    {
+        PoolTestScene scene;
+        ime::GameObjectPool pool;
+        auto prototype = createPrototype(scene);
+        ime::GameObject* prototypePtr = prototype.get();
+
+        pool.addPrototype("bullet", std::move(prototype));
+
+        CHECK(pool.hasPrototype("bullet"));
+        CHECK_FALSE(pool.hasPrototype("rocket"));
+        CHECK_FALSE(prototypePtr->isActive());
+    }
+
+    SUBCASE("acquire() returns an active copy of the prototype")
+    {
+        PoolTestScene scene;
+        ime::GameObjectPool pool;
+        pool.addPrototype("bullet", createPrototype(scene));
+
+        ime::GameObject::Ptr instance = pool.acquire("bullet");
+
+        REQUIRE(instance);
+        CHECK(instance->isActive());
+        CHECK_EQ(instance->getTag(), "bullet");
+        CHECK_EQ(instance->getState(), 2);
+        CHECK_EQ(instance->getTransform().getPosition(), ime::Vector2f(10.0f, 20.0f));
+        CHECK_EQ(instance->getTransform().getOrigin(), ime::Vector2f(1.0f, 1.0f));
+    }
+
+    SUBCASE("reserve() creates available instances in advance")
+    {
+        PoolTestScene scene;
+        ime::GameObjectPool pool;
+        pool.addPrototype("bullet", createPrototype(scene));
+
+        pool.reserve("bullet", 3);
+        CHECK_EQ(pool.getAvailableCount("bullet"), 3u);
+
+        ime::GameObject::Ptr instance = pool.acquire("bullet");
+        CHECK(instance->isActive());
+        CHECK_EQ(pool.getAvailableCount("bullet"), 2u);
+        CHECK_EQ(pool.getAvailableCount("rocket"), 0u);
+    }
+
+    SUBCASE("release() deactivates the instance and makes it available")
+    {
+        PoolTestScene scene;
+        ime::GameObjectPool pool;
+        pool.addPrototype("bullet", createPrototype(scene));
+        ime::GameObject::Ptr instance = pool.acquire("bullet");
+        ime::GameObject* instancePtr = instance.get();
+
+        CHECK(pool.release(std::move(instance)));
+        CHECK_EQ(pool.getAvailableCount("bullet"), 1u);
+        CHECK_FALSE(instancePtr->isActive());
+
+        ime::GameObject::Ptr reused = pool.acquire("bullet");
+        CHECK_EQ(reused.get(), instancePtr);
+        CHECK(reused->isActive());
+        CHECK_EQ(pool.getAvailableCount("bullet"), 0u);
+    }
+
+    SUBCASE("release() does not accept game objects from elsewhere")
+    {
+        PoolTestScene scene;
+        ime::GameObjectPool pool;
+        pool.addPrototype("bullet", createPrototype(scene));
+
+        CHECK_FALSE(pool.release(ime::GameObject::create(scene)));
+        CHECK_EQ(pool.getAvailableCount("bullet"), 0u);
+
+        ime::GameObject::Ptr instance = pool.acquire("bullet");
+        CHECK(pool.removePrototype("bullet"));
+        CHECK_FALSE(pool.removePrototype("bullet"));
+        CHECK_FALSE(pool.release(std::move(instance)));
+    }
+
+    SUBCASE("A reused instance is restored to a copy of the prototype")
+    {
+        PoolTestScene scene;
+        ime::GameObjectPool pool;
+        auto prototype = createPrototype(scene);
+        int prototypeListenerCount = 0;
+        prototype->onPropertyChange("state", [&prototypeListenerCount](const ime::Property&) {
+            prototypeListenerCount++;
+        });
+        pool.addPrototype("bullet", std::move(prototype));
+
+        ime::GameObject::Ptr instance = pool.acquire("bullet");
+        int instanceListenerCount = 0;
+        instance->onPropertyChange("state", [&instanceListenerCount](const ime::Property&) {
+            instanceListenerCount++;
+        });
+        instance->setTag("spent");
+        instance->setState(5);
+        instance->getUserData().addProperty(ime::Property{"damage", 10});
+        instance->getTransform().setPosition(50.0f, 60.0f);
+        instance->getTransform().setOrigin(0.0f, 0.0f);
+        instance->getSprite().setVisible(false);
+        instance->getSprite().setOpacity(100);
+        REQUIRE(pool.release(std::move(instance)));
+
+        prototypeListenerCount = 0;
+        instanceListenerCount = 0;
+        ime::GameObject::Ptr reused = pool.acquire("bullet");
+
+        CHECK_EQ(reused->getTag(), "bullet");
+        CHECK_EQ(reused->getState(), 2);
+        CHECK_FALSE(reused->getUserData().hasProperty("damage"));
+        CHECK_EQ(reused->getTransform().getPosition(), ime::Vector2f(10.0f, 20.0f));
+        CHECK_EQ(reused->getTransform().getOrigin(), ime::Vector2f(1.0f, 1.0f));
+        CHECK(reused->getSprite().isVisible());
+        CHECK_EQ(reused->getSprite().getOpacity(), 255u);
+
+        reused->setState(7);
+        CHECK_EQ(prototypeListenerCount, 1);
+        CHECK_EQ(instanceListenerCount, 0);
+    }
+
+    SUBCASE("A destroyed instance is no longer tracked")
+    {
+        PoolTestScene scene;
+        ime::GameObjectPool pool;
+        pool.addPrototype("bullet", createPrototype(scene));
+        pool.reserve("bullet", 1);
+
+        ime::GameObject::Ptr instance = pool.acquire("bullet");
+        REQUIRE(pool.release(std::move(instance)));
+        instance = pool.acquire("bullet");
+        instance.reset();
+
+        pool.clear();
+        CHECK_FALSE(pool.hasPrototype("bullet"));
+        CHECK_EQ(pool.getAvailableCount("bullet"), 0u);
+    }
+}
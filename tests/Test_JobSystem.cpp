@@ -0,0 +1,236 @@
+////////////////////////////////////////////////////////////////////////////////
+// IME - Infinite Motion Engine
+//
+// Copyright (c) 2020-2022 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "IME/core/engine/JobSystem.h"
+#include <doctest.h>
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+TEST_CASE("ime::JobSystem class")
+{
+    SUBCASE("Constructors")
+    {
+        SUBCASE("Default constructor")
+        {
+            ime::JobSystem jobSystem;
+            CHECK_GE(jobSystem.getThreadCount(), 1);
+        }
+
+        SUBCASE("Thread count constructor")
+        {
+            ime::JobSystem jobSystem(3);
+            CHECK_EQ(jobSystem.getThreadCount(), 3);
+        }
+
+        SUBCASE("Default constructed job systems share their worker threads")
+        {
+            ime::JobSystem first, second;
+            std::mutex mutex;
+            std::set<std::thread::id> workers;
+
+            auto recordWorker = [&mutex, &workers] {
+                std::scoped_lock lock(mutex);
+                workers.insert(std::this_thread::get_id());
+            };
+
+            for (int i = 0; i < 100; i++) {
+                first.schedule(recordWorker);
+                second.schedule(recordWorker);
+            }
+
+            first.waitForAll();
+            second.waitForAll();
+            workers.erase(std::this_thread::get_id());
+
+            CHECK_EQ(first.getThreadCount(), second.getThreadCount());
+            CHECK_LE(workers.size(), first.getThreadCount());
+        }
+    }
+
+    SUBCASE("Job handles")
+    {
+        SUBCASE("A default constructed handle does not refer to a job")
+        {
+            ime::JobHandle handle;
+            CHECK_FALSE(handle.isValid());
+            CHECK(handle.isComplete());
+        }
+
+        SUBCASE("A created job does not execute until it is run")
+        {
+            ime::JobSystem jobSystem(2);
+            std::atomic<bool> isExecuted{false};
+            ime::JobHandle handle = jobSystem.createJob([&isExecuted] { isExecuted = true; });
+
+            CHECK(handle.isValid());
+            CHECK_FALSE(handle.isComplete());
+            CHECK_FALSE(isExecuted);
+
+            jobSystem.run(handle);
+            jobSystem.wait(handle);
+            CHECK(handle.isComplete());
+            CHECK(isExecuted);
+        }
+    }
+
+    SUBCASE("schedule()")
+    {
+        ime::JobSystem jobSystem(4);
+        std::atomic<int> counter{0};
+
+        for (int i = 0; i < 1000; ++i)
+            jobSystem.schedule([&counter] { counter++; });
+
+        jobSystem.waitForAll();
+        CHECK_EQ(counter, 1000);
+    }
+
+    SUBCASE("A parent job completes after its children")
+    {
+        ime::JobSystem jobSystem(4);
+        std::atomic<int> childCount{0};
+        ime::JobHandle parent = jobSystem.createJob([] {});
+
+        for (int i = 0; i < 50; ++i) {
+            jobSystem.run(jobSystem.createChildJob(parent, [&childCount] {
+                childCount++;
+            }));
+        }
+
+        jobSystem.run(parent);
+        jobSystem.wait(parent);
+        CHECK_EQ(childCount, 50);
+    }
+
+    SUBCASE("Children can be attached from within the parent job")
+    {
+        ime::JobSystem jobSystem(2);
+        std::atomic<int> childCount{0};
+        ime::JobHandle parent = jobSystem.createJob([] {});
+        jobSystem.run(jobSystem.createChildJob(parent, [&] {
+            for (int i = 0; i < 10; ++i)
+                jobSystem.run(jobSystem.createChildJob(parent, [&childCount] { childCount++; }));
+        }));
+
+        jobSystem.run(parent);
+        jobSystem.wait(parent);
+        CHECK_EQ(childCount, 10);
+    }
+
+    SUBCASE("wait() rethrows the exception thrown by a job")
+    {
+        ime::JobSystem jobSystem(2);
+        ime::JobHandle handle = jobSystem.schedule([] {
+            throw std::runtime_error("Job failed");
+        });
+
+        CHECK_THROWS_AS(jobSystem.wait(handle), std::runtime_error);
+    }
+
+    SUBCASE("parallelFor()")
+    {
+        SUBCASE("The function is executed once for every index")
+        {
+            ime::JobSystem jobSystem(4);
+            std::vector<int> values(10000, 0);
+
+            jobSystem.parallelFor(0, values.size(), [&values](std::size_t i) {
+                values[i] += static_cast<int>(i);
+            });
+
+            bool isEachIndexVisitedOnce = true;
+            for (std::size_t i = 0; i < values.size(); ++i)
+                isEachIndexVisitedOnce = isEachIndexVisitedOnce && values[i] == static_cast<int>(i);
+
+            CHECK(isEachIndexVisitedOnce);
+        }
+
+        SUBCASE("An empty range does not execute the function")
+        {
+            ime::JobSystem jobSystem(2);
+            bool isExecuted = false;
+            jobSystem.parallelFor(5, 5, [&isExecuted](std::size_t) { isExecuted = true; });
+            CHECK_FALSE(isExecuted);
+        }
+
+        SUBCASE("Nested parallelFor calls complete")
+        {
+            ime::JobSystem jobSystem(2);
+            std::atomic<int> counter{0};
+
+            jobSystem.parallelFor(0, 8, [&](std::size_t) {
+                jobSystem.parallelFor(0, 100, [&counter](std::size_t) { counter++; }, 10);
+            }, 1);
+
+            CHECK_EQ(counter, 800);
+        }
+    }
+
+    SUBCASE("waitForAll() only waits for the jobs of its own job system")
+    {
+        ime::JobSystem first, second;
+        std::atomic<bool> isStarted{false}, isReleased{false};
+
+        second.schedule([&isStarted, &isReleased] {
+            isStarted = true;
+            while (!isReleased)
+                std::this_thread::yield();
+        });
+
+        while (!isStarted)
+            std::this_thread::yield();
+
+        std::atomic<int> counter{0};
+        for (int i = 0; i < 10; i++)
+            first.schedule([&counter] { counter++; });
+
+        first.waitForAll();
+        CHECK_EQ(counter, 10);
+        CHECK_FALSE(isReleased);
+
+        isReleased = true;
+        second.waitForAll();
+    }
+
+    SUBCASE("Main thread jobs")
+    {
+        ime::JobSystem jobSystem(2);
+        std::vector<int> order;
+
+        ime::JobHandle handle = jobSystem.schedule([&jobSystem, &order] {
+            jobSystem.runOnMainThread([&order] { order.push_back(1); });
+            jobSystem.runOnMainThread([&order] { order.push_back(2); });
+        });
+
+        jobSystem.wait(handle);
+        CHECK(order.empty());
+        CHECK_EQ(jobSystem.executeMainThreadJobs(), 2);
+        CHECK_EQ(order, std::vector<int>({1, 2}));
+        CHECK_EQ(jobSystem.executeMainThreadJobs(), 0);
+    }
+}
@@ -24,10 +24,12 @@
 
 #include "IME/core/object/Object.h"
 #include <doctest.h>
+#include <vector>
 
 class TestObject : public ime::Object {
 public:
     using ime::Object::emitDestruction;
+    using ime::Object::emitChange;
 
     std::string getClassName() const override {
         return "TestObject";
@@ -138,6 +140,111 @@ TEST_CASE("ime::Object class")
             CHECK_EQ(propertyValue, "playerTwo");
         }
 
+        SUBCASE("onTypedPropertyChange()")
+        {
+            SUBCASE("The notification refers to the name and value of the property")
+            {
+                TestObject object;
+                ime::Uint64 id = 0;
+                std::string name;
+                std::string value;
+
+                object.onTypedPropertyChange([&](const ime::PropertyChange& change) {
+                    id = change.id;
+                    name = change.name;
+                    value = std::get<std::string_view>(change.value);
+                });
+
+                object.setTag("playerOne");
+
+                CHECK_EQ(id, ime::PropertyChange::idOf("tag"));
+                CHECK_EQ(name, "tag");
+                CHECK_EQ(value, "playerOne");
+            }
+
+            SUBCASE("Values are converted to property values")
+            {
+                enum class Level { Low, High };
+                TestObject object;
+                const auto vector = ime::Vector2f(1.0f, 2.0f);
+
+                CHECK_EQ(std::get<float>(ime::makePropertyValue(2.5f)), 2.5f);
+                CHECK_EQ(std::get<int>(ime::makePropertyValue(Level::High)), 1);
+                CHECK_EQ(std::get<ime::Vector2f>(ime::makePropertyValue(vector)), vector);
+
+                TestObject* pointer = &object;
+                const auto pointerValue = ime::makePropertyValue(pointer);
+                REQUIRE(std::holds_alternative<ime::AnyPropertyValue>(pointerValue));
+                CHECK(std::get<ime::AnyPropertyValue>(pointerValue).is<TestObject*>());
+                CHECK_EQ(*std::get<ime::AnyPropertyValue>(pointerValue).get<TestObject*>(), &object);
+                CHECK_EQ(std::get<ime::AnyPropertyValue>(pointerValue).get<int>(), nullptr);
+            }
+
+            SUBCASE("Changes emitted as an ime::Property are published")
+            {
+                TestObject object;
+                std::vector<ime::PropertyChange> changes;
+                std::string name;
+                bool isReferredToProperty = false;
+
+                object.onTypedPropertyChange([&](const ime::PropertyChange& change) {
+                    changes.push_back(change);
+                    name = change.name;
+                    if (auto value = std::get_if<ime::AnyPropertyValue>(&change.value))
+                        isReferredToProperty = value->is<ime::Property>();
+                });
+
+                object.emitChange(ime::Property{"speed", 2.0f});
+                REQUIRE_EQ(changes.size(), 1u);
+                CHECK_EQ(changes[0].id, ime::PropertyChange::idOf("speed"));
+                CHECK_EQ(name, "speed");
+                CHECK_EQ(std::get<float>(changes[0].value), 2.0f);
+
+                object.emitChange(ime::Property{"moved"});
+                REQUIRE_EQ(changes.size(), 2u);
+                CHECK(std::holds_alternative<std::monostate>(changes[1].value));
+
+                object.emitChange(ime::Property{"level", std::size_t{3}});
+                REQUIRE_EQ(changes.size(), 3u);
+                CHECK(isReferredToProperty);
+            }
+
+            SUBCASE("Typed and untyped listeners are both notified")
+            {
+                TestObject object;
+                int typedCount = 0;
+                int namedCount = 0;
+                int anyCount = 0;
+
+                object.onTypedPropertyChange([&typedCount](const ime::PropertyChange&) { typedCount++; });
+                const auto position = ime::Vector2f(3.0f, 4.0f);
+                object.onPropertyChange("position", [&namedCount, position](const ime::Property& property) {
+                    CHECK_EQ(property.getValue<ime::Vector2f>(), position);
+                    namedCount++;
+                });
+                object.onPropertyChange([&anyCount](const ime::Property&) { anyCount++; });
+
+                object.emitChange("position", position);
+                object.emitChange("rotation", 90.0f);
+
+                CHECK_EQ(typedCount, 2);
+                CHECK_EQ(namedCount, 1);
+                CHECK_EQ(anyCount, 2);
+            }
+
+            SUBCASE("A typed listener can be removed by id")
+            {
+                TestObject object;
+                bool isInvoked = false;
+                int id = object.onTypedPropertyChange([&isInvoked](const ime::PropertyChange&) { isInvoked = true; });
+
+                CHECK(object.removeEventListener(id));
+                object.setTag("player");
+
+                CHECK_FALSE(isInvoked);
+            }
+        }
+
         SUBCASE("onPropertyChange(property, callback, oneTime = true)")
         {
             TestObject object;
@@ -0,0 +1,431 @@
+////////////////////////////////////////////////////////////////////////////////
+// IME - Infinite Motion Engine
+//
+// Copyright (c) 2020-2022 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "IME/core/object/ObjectContainer.h"
+#include <doctest.h>
+#include <atomic>
+#include <vector>
+
+class ContainerTestObject : public ime::Object {
+public:
+    explicit ContainerTestObject(const std::string& tag = "") {
+        setTag(tag);
+    }
+
+    std::string getClassName() const override {
+        return "ContainerTestObject";
+    }
+
+    int visitCount = 0;
+};
+
+using TestContainer = ime::ObjectContainer<ContainerTestObject>;
+
+TEST_CASE("ime::ObjectContainer class template")
+{
+    SUBCASE("Lookups")
+    {
+        SUBCASE("findById() finds objects in groups")
+        {
+            TestContainer container;
+            auto* object = container.addObject(std::make_unique<ContainerTestObject>(), "enemies");
+
+            CHECK_EQ(container.findById(object->getObjectId()), object);
+            CHECK_EQ(container.getGroup("enemies").findById(object->getObjectId()), object);
+            CHECK_EQ(container.getCount(), 1);
+        }
+
+        SUBCASE("findByTag() finds objects in groups")
+        {
+            TestContainer container;
+            container.addObject(std::make_unique<ContainerTestObject>("player"));
+            auto* enemy = container.addObject(std::make_unique<ContainerTestObject>("enemy"), "enemies");
+
+            CHECK_EQ(container.findByTag("enemy"), enemy);
+            CHECK_FALSE(container.findByTag("ghost"));
+        }
+
+        SUBCASE("findByTag() returns the first object added with the tag")
+        {
+            TestContainer container;
+            container.addObject(std::make_unique<ContainerTestObject>("enemy"), "enemies");
+            auto* first = container.addObject(std::make_unique<ContainerTestObject>("enemy"));
+            auto* second = container.addObject(std::make_unique<ContainerTestObject>("enemy"));
+            container.addObject(std::make_unique<ContainerTestObject>("enemy"));
+
+            CHECK_EQ(container.findByTag("enemy"), first);
+
+            first->setTag("boss");
+            CHECK_EQ(container.findByTag("enemy"), second);
+        }
+
+        SUBCASE("Assigning an object updates the tag index")
+        {
+            TestContainer container;
+            auto* object = container.addObject(std::make_unique<ContainerTestObject>("enemy"));
+            *object = ContainerTestObject{"boss"};
+
+            CHECK_FALSE(container.findByTag("enemy"));
+            CHECK_EQ(container.findByTag("boss"), object);
+        }
+
+        SUBCASE("Objects added directly to a group can be found from the container")
+        {
+            TestContainer container;
+            auto* object = container.createGroup("enemies").addObject(std::make_unique<ContainerTestObject>("enemy"));
+
+            CHECK_EQ(container.findById(object->getObjectId()), object);
+            CHECK_EQ(container.findByTag("enemy"), object);
+            CHECK_EQ(container.getCount(), 1);
+        }
+
+        SUBCASE("Changing the tag of an object updates the tag index")
+        {
+            TestContainer container;
+            auto* object = container.addObject(std::make_unique<ContainerTestObject>("enemy"), "enemies");
+            object->setTag("boss");
+
+            CHECK_FALSE(container.findByTag("enemy"));
+            CHECK_EQ(container.findByTag("boss"), object);
+            CHECK_EQ(container.getGroup("enemies").findByTag("boss"), object);
+        }
+
+        SUBCASE("Changing the tag of a copy of an object does not update the tag index")
+        {
+            TestContainer container;
+            auto* object = container.addObject(std::make_unique<ContainerTestObject>("enemy"));
+
+            ContainerTestObject copy{*object};
+            copy.setTag("copy");
+
+            CHECK_EQ(container.findByTag("enemy"), object);
+            CHECK_FALSE(container.findByTag("copy"));
+        }
+
+        SUBCASE("Tag changes are tracked after the container is moved")
+        {
+            TestContainer container;
+            auto* object = container.addObject(std::make_unique<ContainerTestObject>("enemy"));
+
+            TestContainer moved{std::move(container)};
+            object->setTag("boss");
+
+            CHECK_EQ(moved.findByTag("boss"), object);
+            CHECK_EQ(moved.findById(object->getObjectId()), object);
+            CHECK_EQ(container.getCount(), 0);
+        }
+    }
+
+    SUBCASE("Removal")
+    {
+        SUBCASE("removeById()")
+        {
+            TestContainer container;
+            auto id = container.addObject(std::make_unique<ContainerTestObject>("enemy"), "enemies")->getObjectId();
+            container.removeById(id);
+
+            CHECK_FALSE(container.findById(id));
+            CHECK_FALSE(container.findByTag("enemy"));
+            CHECK_EQ(container.getCount(), 0);
+            CHECK_EQ(container.getGroup("enemies").getCount(), 0);
+        }
+
+        SUBCASE("removeByTag() removes all objects with the tag")
+        {
+            TestContainer container;
+            container.addObject(std::make_unique<ContainerTestObject>("enemy"));
+            container.addObject(std::make_unique<ContainerTestObject>("enemy"), "enemies");
+            container.addObject(std::make_unique<ContainerTestObject>("player"));
+            container.removeByTag("enemy");
+
+            CHECK_FALSE(container.findByTag("enemy"));
+            CHECK_EQ(container.getCount(), 1);
+        }
+
+        SUBCASE("remove()")
+        {
+            TestContainer container;
+            auto* object = container.addObject(std::make_unique<ContainerTestObject>(), "enemies");
+            ContainerTestObject other;
+
+            CHECK_FALSE(container.remove(&other));
+            CHECK(container.remove(object));
+            CHECK_EQ(container.getCount(), 0);
+        }
+
+        SUBCASE("removeIf()")
+        {
+            TestContainer container;
+            container.addObject(std::make_unique<ContainerTestObject>("a"));
+            container.addObject(std::make_unique<ContainerTestObject>("b"), "group");
+            container.removeIf([](const ContainerTestObject* object) {
+                return object->getTag() == "b";
+            });
+
+            CHECK_FALSE(container.findByTag("b"));
+            CHECK(container.findByTag("a"));
+            CHECK_EQ(container.getCount(), 1);
+        }
+
+        SUBCASE("removeGroup() removes the objects of the group from the index")
+        {
+            TestContainer container;
+            auto id = container.addObject(std::make_unique<ContainerTestObject>("enemy"), "enemies")->getObjectId();
+            container.removeGroup("enemies");
+
+            CHECK_FALSE(container.findById(id));
+            CHECK_FALSE(container.findByTag("enemy"));
+            CHECK_EQ(container.getCount(), 0);
+        }
+
+        SUBCASE("removeAll() on a group removes its objects from the container")
+        {
+            TestContainer container;
+            container.addObject(std::make_unique<ContainerTestObject>("player"));
+            container.addObject(std::make_unique<ContainerTestObject>("enemy"), "enemies");
+            container.getGroup("enemies").removeAll();
+
+            CHECK_FALSE(container.findByTag("enemy"));
+            CHECK_EQ(container.getCount(), 1);
+        }
+
+        SUBCASE("An object can be removed without being destroyed")
+        {
+            TestContainer container;
+            ContainerTestObject* object = container.addObject(std::make_unique<ContainerTestObject>("player"), "players");
+            unsigned int id = object->getObjectId();
+
+            TestContainer::ObjectPtr extracted = container.extractById(id);
+
+            CHECK_EQ(extracted.get(), object);
+            CHECK_EQ(container.getCount(), 0);
+            CHECK_FALSE(container.findById(id));
+            CHECK_FALSE(container.findByTag("player"));
+            CHECK_FALSE(container.extractById(id));
+
+            // The container no longer tracks the tag of the object
+            extracted->setTag("enemy");
+            CHECK_FALSE(container.findByTag("enemy"));
+
+            container.addObject(std::move(extracted));
+            CHECK_EQ(container.findByTag("enemy"), object);
+        }
+    }
+
+    SUBCASE("Storage")
+    {
+        SUBCASE("Objects keep their order when other objects are removed")
+        {
+            TestContainer container;
+            std::vector<unsigned int> ids;
+            for (int i = 0; i < 10; i++)
+                ids.push_back(container.addObject(std::make_unique<ContainerTestObject>())->getObjectId());
+
+            for (int i = 0; i < 10; i += 2)
+                container.removeById(ids[i]);
+
+            container.removeById(ids[1]);
+
+            std::vector<unsigned int> visited;
+            container.forEach([&visited](ContainerTestObject* object) {
+                visited.push_back(object->getObjectId());
+            });
+
+            const std::vector<unsigned int> expected{ids[3], ids[5], ids[7], ids[9]};
+            CHECK_EQ(visited, expected);
+
+            for (unsigned int id : expected)
+                CHECK_EQ(container.findById(id)->getObjectId(), id);
+        }
+
+        SUBCASE("Objects can be added and removed while the container is iterated")
+        {
+            TestContainer container;
+            std::vector<unsigned int> ids;
+            for (int i = 0; i < 8; i++)
+                ids.push_back(container.addObject(std::make_unique<ContainerTestObject>())->getObjectId());
+
+            int visitCount = 0;
+            container.forEach([&](ContainerTestObject* object) {
+                visitCount++;
+
+                if (object->getObjectId() == ids[0]) {
+                    for (int i = 4; i < 8; i++)
+                        container.removeById(ids[i]);
+
+                    container.addObject(std::make_unique<ContainerTestObject>("added"));
+                }
+            });
+
+            // The added object is visited by the next iteration
+            CHECK_EQ(visitCount, 4);
+            CHECK_EQ(container.getCount(), 5);
+            CHECK(container.findByTag("added"));
+        }
+    }
+
+    SUBCASE("Deferred changes")
+    {
+        SUBCASE("An object can remove itself while the container is iterated")
+        {
+            TestContainer container;
+            for (int i = 0; i < 4; i++)
+                container.addObject(std::make_unique<ContainerTestObject>());
+
+            int visitCount = 0;
+            container.forEach([&](ContainerTestObject* object) {
+                visitCount++;
+                unsigned int id = object->getObjectId();
+                container.removeById(id);
+
+                // The removed object remains valid until the iteration ends
+                CHECK_EQ(object->getObjectId(), id);
+                CHECK_FALSE(container.findById(id));
+            });
+
+            CHECK_EQ(visitCount, 4);
+            CHECK_EQ(container.getCount(), 0);
+        }
+
+        SUBCASE("A group can be removed while the container is iterated")
+        {
+            TestContainer container;
+            container.addObject(std::make_unique<ContainerTestObject>());
+            container.addObject(std::make_unique<ContainerTestObject>());
+            ContainerTestObject* grouped = container.addObject(std::make_unique<ContainerTestObject>(), "Group2");
+            unsigned int groupedId = grouped->getObjectId();
+
+            int visitCount = 0;
+            container.forEach([&](ContainerTestObject*) {
+                visitCount++;
+                container.removeGroup("Group2");
+            });
+
+            CHECK_EQ(visitCount, 2);
+            CHECK_FALSE(container.hasGroup("Group2"));
+            CHECK_FALSE(container.findById(groupedId));
+            CHECK_EQ(container.getCount(), 2);
+        }
+
+        SUBCASE("All objects can be removed while the container is iterated")
+        {
+            TestContainer container;
+            for (int i = 0; i < 4; i++)
+                container.addObject(std::make_unique<ContainerTestObject>());
+            container.addObject(std::make_unique<ContainerTestObject>(), "Group");
+
+            int visitCount = 0;
+            container.forEach([&](ContainerTestObject*) {
+                visitCount++;
+                container.removeAll();
+            });
+
+            CHECK_EQ(visitCount, 1);
+            CHECK_EQ(container.getCount(), 0);
+            CHECK_FALSE(container.hasGroup("Group"));
+
+            container.addObject(std::make_unique<ContainerTestObject>("new"));
+            CHECK_EQ(container.getCount(), 1);
+            CHECK(container.findByTag("new"));
+        }
+
+        SUBCASE("Objects added while the container is iterated are visited by the next iteration")
+        {
+            TestContainer container;
+            container.addObject(std::make_unique<ContainerTestObject>());
+
+            int visitCount = 0;
+            container.forEach([&](ContainerTestObject*) {
+                visitCount++;
+                container.addObject(std::make_unique<ContainerTestObject>("added"));
+                container.addObject(std::make_unique<ContainerTestObject>("added"), "NewGroup");
+            });
+
+            CHECK_EQ(visitCount, 1);
+            CHECK_EQ(container.getCount(), 3);
+
+            visitCount = 0;
+            container.forEach([&](ContainerTestObject*) {
+                visitCount++;
+            });
+
+            CHECK_EQ(visitCount, 3);
+        }
+    }
+
+    SUBCASE("Parallel iteration")
+    {
+        SUBCASE("The callback is applied to each object exactly once")
+        {
+            ime::JobSystem jobSystem{4};
+            TestContainer container;
+            std::vector<ContainerTestObject*> objects;
+            for (int i = 0; i < 1000; i++)
+                objects.push_back(container.addObject(std::make_unique<ContainerTestObject>(), i % 2 ? "odd" : "none"));
+
+            container.parallelForEach(jobSystem, [](ContainerTestObject* object) {
+                object->visitCount++;
+            }, 16);
+
+            bool visitedOnce = true;
+            for (ContainerTestObject* object : objects)
+                visitedOnce = visitedOnce && object->visitCount == 1;
+
+            CHECK(visitedOnce);
+            CHECK_EQ(container.getCount(), 1000);
+        }
+
+        SUBCASE("The callback can be applied to the objects of a single group")
+        {
+            ime::JobSystem jobSystem{4};
+            TestContainer container;
+            for (int i = 0; i < 100; i++)
+                container.addObject(std::make_unique<ContainerTestObject>(), i % 4 ? "none" : "group");
+
+            std::atomic<int> visitCount{0};
+            container.parallelForEachInGroup(jobSystem, "group", [&visitCount](ContainerTestObject*) {
+                visitCount++;
+            });
+
+            container.parallelForEachInGroup(jobSystem, "unknown", [&visitCount](ContainerTestObject*) {
+                visitCount++;
+            });
+
+            CHECK_EQ(visitCount.load(), 25);
+        }
+
+        SUBCASE("An empty container is not iterated")
+        {
+            ime::JobSystem jobSystem{2};
+            TestContainer container;
+
+            bool visited = false;
+            container.parallelForEach(jobSystem, [&visited](ContainerTestObject*) {
+                visited = true;
+            });
+
+            CHECK_FALSE(visited);
+        }
+    }
+}
@@ -0,0 +1,170 @@
+////////////////////////////////////////////////////////////////////////////////
+// IME - Infinite Motion Engine
+//
+// Copyright (c) 2020-2022 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "IME/core/engine/SessionRecorder.h"
+#include "IME/core/engine/SessionPlayer.h"
+#include "IME/core/exceptions/Exceptions.h"
+#include <doctest.h>
+#include <cstdio>
+#include <fstream>
+
+namespace {
+    const std::string sessionFile = "Test_SessionRecording.imes";
+
+    ime::EventBatch createEvents() {
+        ime::EventBatch events;
+
+        ime::Event keyEvent;
+        keyEvent.type = ime::Event::KeyPressed;
+        keyEvent.key.code = ime::input::Keyboard::Key::Space;
+        keyEvent.key.alt = false;
+        keyEvent.key.control = true;
+        keyEvent.key.shift = false;
+        keyEvent.key.system = true;
+        events.push(keyEvent);
+
+        ime::Event mouseEvent;
+        mouseEvent.type = ime::Event::MouseMoved;
+        mouseEvent.mouseMove.x = -20;
+        mouseEvent.mouseMove.y = 300;
+        events.push(mouseEvent);
+
+        ime::Event joystickEvent;
+        joystickEvent.type = ime::Event::JoystickMoved;
+        joystickEvent.joystickMove.joystickId = 1;
+        joystickEvent.joystickMove.axis = ime::input::Joystick::Axis::PovY;
+        joystickEvent.joystickMove.position = -42.5f;
+        events.push(joystickEvent);
+
+        ime::Event closedEvent;
+        closedEvent.type = ime::Event::Closed;
+        events.push(closedEvent);
+
+        return events;
+    }
+}
+
+TEST_CASE("ime::SessionRecorder and ime::SessionPlayer classes")
+{
+    SUBCASE("A recording plays back the recorded frames in order")
+    {
+        ime::SessionRecorder recorder;
+        CHECK_FALSE(recorder.isRecording());
+
+        recorder.start(sessionFile);
+        CHECK(recorder.isRecording());
+        recorder.recordFrame(ime::milliseconds(16), createEvents());
+        recorder.recordFrame(ime::microseconds(16667), ime::EventBatch());
+        CHECK_EQ(recorder.getFrameCount(), 2u);
+        recorder.stop();
+        CHECK_FALSE(recorder.isRecording());
+
+        ime::SessionPlayer player;
+        player.open(sessionFile);
+        CHECK(player.isOpen());
+
+        ime::Time deltaTime;
+        ime::EventBatch events;
+
+        REQUIRE(player.readFrame(deltaTime, events));
+        CHECK_EQ(deltaTime, ime::milliseconds(16));
+        REQUIRE_EQ(events.getCount(), 4u);
+
+        auto event = events.begin();
+        CHECK_EQ(event->type, ime::Event::KeyPressed);
+        CHECK_EQ(event->key.code, ime::input::Keyboard::Key::Space);
+        CHECK_FALSE(event->key.alt);
+        CHECK(event->key.control);
+        CHECK_FALSE(event->key.shift);
+        CHECK(event->key.system);
+
+        ++event;
+        CHECK_EQ(event->type, ime::Event::MouseMoved);
+        CHECK_EQ(event->mouseMove.x, -20);
+        CHECK_EQ(event->mouseMove.y, 300);
+
+        ++event;
+        CHECK_EQ(event->type, ime::Event::JoystickMoved);
+        CHECK_EQ(event->joystickMove.joystickId, 1u);
+        CHECK_EQ(event->joystickMove.axis, ime::input::Joystick::Axis::PovY);
+        CHECK_EQ(event->joystickMove.position, -42.5f);
+
+        ++event;
+        CHECK_EQ(event->type, ime::Event::Closed);
+
+        REQUIRE(player.readFrame(deltaTime, events));
+        CHECK_EQ(deltaTime, ime::microseconds(16667));
+        CHECK(events.isEmpty());
+
+        CHECK_FALSE(player.readFrame(deltaTime, events));
+        CHECK_EQ(player.getFrameCount(), 2u);
+
+        player.close();
+        CHECK_FALSE(player.isOpen());
+        std::remove(sessionFile.c_str());
+    }
+
+    SUBCASE("A truncated frame ends the playback")
+    {
+        ime::SessionRecorder recorder;
+        recorder.start(sessionFile);
+        recorder.recordFrame(ime::milliseconds(16), createEvents());
+        recorder.stop();
+
+        // Drop the last byte of the recording
+        std::ifstream input(sessionFile, std::ios::binary);
+        std::string content((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+        input.close();
+        std::ofstream output(sessionFile, std::ios::binary | std::ios::trunc);
+        output.write(content.data(), static_cast<std::streamsize>(content.size() - 1));
+        output.close();
+
+        ime::SessionPlayer player;
+        player.open(sessionFile);
+
+        ime::Time deltaTime;
+        ime::EventBatch events;
+        CHECK_FALSE(player.readFrame(deltaTime, events));
+        CHECK(events.isEmpty());
+        std::remove(sessionFile.c_str());
+    }
+
+    SUBCASE("Opening a file that is not a recording throws")
+    {
+        std::ofstream output(sessionFile, std::ios::binary | std::ios::trunc);
+        output << "not a recording";
+        output.close();
+
+        ime::SessionPlayer player;
+        CHECK_THROWS_AS(player.open(sessionFile), ime::InvalidParseException);
+        CHECK_FALSE(player.isOpen());
+        std::remove(sessionFile.c_str());
+    }
+
+    SUBCASE("Opening a file that does not exist throws")
+    {
+        ime::SessionPlayer player;
+        CHECK_THROWS_AS(player.open("Test_SessionRecording_missing.imes"), ime::FileNotFoundException);
+    }
+}
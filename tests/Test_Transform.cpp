@@ -24,6 +24,8 @@
 
 #include "IME/common/Transform.h"
 #include <doctest.h>
+#include <string>
+#include <vector>
 
 TEST_CASE("ime::Transform class")
 {
@@ -211,4 +213,149 @@ TEST_CASE("ime::Transform class")
         transform.move(1.0f, 2.0f);
         CHECK(isInvoked);
     }
+
+    SUBCASE("Render interpolation")
+    {
+        SUBCASE("Interpolation is disabled by default")
+        {
+            ime::Transform transform;
+            transform.setPosition(10.0f, 20.0f);
+
+            CHECK_FALSE(transform.isInterpolationEnabled());
+            CHECK_EQ(transform.getInterpolatedPosition(0.5f), ime::Vector2f(10.0f, 20.0f));
+        }
+
+        SUBCASE("getInterpolatedPosition()")
+        {
+            ime::Transform transform;
+            transform.setInterpolationEnabled(true);
+            transform.savePreviousState();
+            transform.setPosition(10.0f, 20.0f);
+
+            CHECK_EQ(transform.getInterpolatedPosition(0.0f), ime::Vector2f(0.0f, 0.0f));
+            CHECK_EQ(transform.getInterpolatedPosition(0.5f), ime::Vector2f(5.0f, 10.0f));
+            CHECK_EQ(transform.getInterpolatedPosition(1.0f), ime::Vector2f(10.0f, 20.0f));
+            CHECK_EQ(transform.getPosition(), ime::Vector2f(10.0f, 20.0f));
+        }
+
+        SUBCASE("getInterpolatedRotation() takes the shortest arc")
+        {
+            ime::Transform transform;
+            transform.setRotation(350.0f);
+            transform.setInterpolationEnabled(true);
+            transform.savePreviousState();
+            transform.setRotation(10.0f);
+
+            CHECK_EQ(transform.getInterpolatedRotation(0.5f), 0.0f);
+        }
+
+        SUBCASE("Disabling interpolation reports the current position and rotation")
+        {
+            ime::Transform transform;
+            transform.setDeferredSyncEnabled(true);
+            transform.setInterpolationEnabled(true);
+            transform.setPosition(10.0f, 20.0f);
+            transform.setRotation(90.0f);
+            transform.flushChanges();
+
+            std::vector<std::string> names;
+            transform.onPropertyChange([&names](const ime::Property& property) {
+                names.push_back(property.getName());
+            });
+
+            transform.setInterpolationEnabled(false);
+
+            REQUIRE_EQ(names.size(), 3u);
+            CHECK_EQ(names[0], "interpolationEnable");
+            CHECK_EQ(names[1], "position");
+            CHECK_EQ(names[2], "rotation");
+            CHECK_EQ(transform.getInterpolatedPosition(0.5f), ime::Vector2f(10.0f, 20.0f));
+        }
+    }
+
+    SUBCASE("Deferred change notifications")
+    {
+        SUBCASE("Notifications are immediate by default")
+        {
+            ime::Transform transform;
+            transform.setPosition(10.0f, 20.0f);
+
+            CHECK_FALSE(transform.isDeferredSyncEnabled());
+            CHECK_FALSE(transform.isDirty());
+        }
+
+        SUBCASE("Changes are reported once with their final value")
+        {
+            ime::Transform transform;
+            transform.setDeferredSyncEnabled(true);
+
+            std::vector<std::string> names;
+            ime::Vector2f position;
+            transform.onPropertyChange([&names, &position](const ime::Property& property) {
+                names.push_back(property.getName());
+
+                if (property.getName() == "position")
+                    position = property.getValue<ime::Vector2f>();
+            });
+
+            transform.setScale(2.0f, 2.0f);
+            transform.setPosition(10.0f, 20.0f);
+            transform.move(5.0f, 5.0f);
+            transform.move(5.0f, 5.0f);
+
+            CHECK(names.empty());
+            CHECK(transform.isDirty());
+            CHECK_EQ(transform.getPosition(), ime::Vector2f(20.0f, 30.0f));
+
+            transform.flushChanges();
+
+            REQUIRE_EQ(names.size(), 2u);
+            CHECK_EQ(names[0], "position");
+            CHECK_EQ(names[1], "scale");
+            CHECK_EQ(position, ime::Vector2f(20.0f, 30.0f));
+            CHECK_FALSE(transform.isDirty());
+
+            transform.flushChanges();
+            CHECK_EQ(names.size(), 2u);
+        }
+
+        SUBCASE("Disabling deferred notifications flushes pending changes")
+        {
+            ime::Transform transform;
+            transform.setDeferredSyncEnabled(true);
+
+            int count = 0;
+            transform.onPropertyChange([&count](const ime::Property&) { count++; });
+
+            transform.setRotation(45.0f);
+            CHECK_EQ(count, 0);
+
+            transform.setDeferredSyncEnabled(false);
+            CHECK_EQ(count, 1);
+            CHECK_FALSE(transform.isDirty());
+
+            transform.setRotation(90.0f);
+            CHECK_EQ(count, 2);
+        }
+
+        SUBCASE("Dirty listeners are notified once between flushes")
+        {
+            ime::Transform transform;
+            int count = 0;
+            transform.onDirty(ime::Callback<>([&count] { count++; }));
+
+            transform.setPosition(10.0f, 20.0f);
+            CHECK_EQ(count, 0);
+
+            transform.setDeferredSyncEnabled(true);
+            transform.setPosition(20.0f, 30.0f);
+            transform.setRotation(45.0f);
+            transform.setScale(2.0f, 2.0f);
+            CHECK_EQ(count, 1);
+
+            transform.flushChanges();
+            transform.setOrigin(5.0f, 5.0f);
+            CHECK_EQ(count, 2);
+        }
+    }
 }
\ No newline at end of file